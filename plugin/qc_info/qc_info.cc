@@ -277,6 +277,19 @@ static int qc_info_fill_table(THD *thd, TABLE_LIST *tables,
   return status;
 }
 
+/*
+  Query cache hit, miss and lock contention counters.
+  The values point into the query cache, see qc_info_plugin_init().
+*/
+static SHOW_VAR qc_info_status[]=
+{
+  {"Query_cache_info_hits",          0, SHOW_LONG},
+  {"Query_cache_info_misses",        0, SHOW_LONG},
+  {"Query_cache_info_lock_waits",    0, SHOW_LONG},
+  {"Query_cache_info_lock_timeouts", 0, SHOW_LONG},
+  {NullS, NullS, SHOW_LONG}
+};
+
 static int qc_info_plugin_init(void *p)
 {
   ST_SCHEMA_TABLE *schema= (ST_SCHEMA_TABLE *)p;
@@ -291,7 +304,14 @@ static int qc_info_plugin_init(void *p)
   qc = (Accessible_Query_Cache *)&query_cache;
 #endif
 
-  return qc == 0;
+  if (qc == 0)
+    return 1;
+
+  qc_info_status[0].value= (char*) &qc->hits;
+  qc_info_status[1].value= (char*) &qc->misses;
+  qc_info_status[2].value= (char*) &qc->lock_waits;
+  qc_info_status[3].value= (char*) &qc->lock_timeouts;
+  return 0;
 }
 
 
@@ -312,10 +332,10 @@ maria_declare_plugin(query_cache_info)
   PLUGIN_LICENSE_BSD,
   qc_info_plugin_init, /* Plugin Init */
   0,                          /* Plugin Deinit        */
-  0x0101,                     /* version, hex         */
-  NULL,                       /* status variables     */
+  0x0102,                     /* version, hex         */
+  qc_info_status,             /* status variables     */
   NULL,                       /* system variables     */
-  "1.1",                      /* version as a string  */
+  "1.2",                      /* version as a string  */
   MariaDB_PLUGIN_MATURITY_STABLE
 }
 maria_declare_plugin_end;
@@ -63,13 +63,13 @@ class Bounded_queue
 
   /**
      Function for comparing two keys.
-     @param  n Pointer to number of bytes to compare.
+     @param  arg Sort parameters.
      @param  a First key.
      @param  b Second key.
      @retval -1, 0, or 1 depending on whether the left argument is 
              less than, equal to, or greater than the right argument.
    */
-  typedef int (*compare_function)(size_t *n, Key_type **a, Key_type **b);
+  typedef int (*compare_function)(void *arg, Key_type **a, Key_type **b);
 
   /**
     Initialize the queue.
@@ -80,7 +80,8 @@ class Bounded_queue
                   pop() will return the smallest key in the result set.
            true:  We keep the n smallest elements.
                   pop() will return the largest key in the result set.
-    @param compare        Compare function for elements, takes 3 arguments.
+    @param compare        Compare function for elements, takes 3 arguments,
+                          the first one being sort_param.
                           If NULL, we use get_ptr_compare(compare_length).
     @param compare_length Length of the data (i.e. the keys) used for sorting.
     @param keymaker       Function which generates keys for elements.
@@ -162,14 +163,18 @@ int Bounded_queue<Element_type, Key_type>::init(ha_rows max_elements,
   // init_queue() takes an uint, and also does (max_elements + 1)
   if (max_elements >= (UINT_MAX - 1))
     return 1;
+  void *compare_arg= sort_param;
   if (compare == NULL)
+  {
     compare=
       reinterpret_cast<compare_function>(get_ptr_compare(compare_length));
+    compare_arg= &m_compare_length;
+  }
   // We allocate space for one extra element, for replace when queue is full.
   return init_queue(&m_queue, (uint) max_elements + 1,
                     0, max_at_top,
                     reinterpret_cast<queue_compare>(compare),
-                    &m_compare_length, 0, 0);
+                    compare_arg, 0, 0);
 }
 
 
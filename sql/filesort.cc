@@ -49,12 +49,14 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
 static bool write_keys(Sort_param *param, SORT_INFO *fs_info,
                       uint count, IO_CACHE *buffer_file, IO_CACHE *tempfile);
 static void make_sortkey(Sort_param *param, uchar *to, uchar *ref_pos);
+static void make_packed_sortkey(Sort_param *param, uchar *to,
+                                uchar *ref_pos);
 static void register_used_fields(Sort_param *param);
 static bool save_index(Sort_param *param, uint count,
                        SORT_INFO *table_sort);
 static uint suffix_length(ulong string_length);
 static uint sortlength(THD *thd, SORT_FIELD *sortorder, uint s_length,
-		       bool *multi_byte_charset);
+		       bool *multi_byte_charset, bool *packed_sortkeys);
 static SORT_ADDON_FIELD *get_addon_fields(TABLE *table, uint sortlength,
                                           LEX_STRING *addon_buf);
 static void unpack_addon_fields(struct st_sort_addon_field *addon_field,
@@ -91,9 +93,13 @@ void Sort_param::init_for_filesort(uint sortlen, TABLE *table,
       The reference to the record is considered 
       as an additional sorted field
     */
-    sort_length+= ref_length;
+    if (!using_packed_sortkeys())
+      sort_length+= ref_length;
   }
-  rec_length= sort_length + (uint)addon_buf.length;
+  if (using_packed_sortkeys())
+    rec_length= sort_length + res_length;
+  else
+    rec_length= sort_length + (uint)addon_buf.length;
   max_rows= maxrows;
 }
 
@@ -142,7 +148,8 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
   Bounded_queue<uchar, uchar> pq;
   SQL_SELECT *const select= filesort->select;
   ha_rows max_rows= filesort->limit;
-  uint s_length= 0;
+  uint s_length= 0, sort_len;
+  bool packed_sortkeys;
 
   DBUG_ENTER("filesort");
 
@@ -179,9 +186,12 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
   error= 1;
   sort->found_rows= HA_POS_ERROR;
 
-  param.init_for_filesort(sortlength(thd, filesort->sortorder, s_length,
-                                     &multi_byte_charset),
-                          table, max_rows, filesort->sort_positions);
+  sort_len= sortlength(thd, filesort->sortorder, s_length,
+                       &multi_byte_charset, &packed_sortkeys);
+  param.set_using_packed_sortkeys(packed_sortkeys);
+  param.init_for_filesort(sort_len, table, max_rows,
+                          filesort->sort_positions);
+  param.max_sort_threads= thd->variables.max_sort_threads;
 
   sort->addon_buf=    param.addon_buf;
   sort->addon_field=  param.addon_field;
@@ -211,7 +221,8 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     const size_t compare_length= param.sort_length;
     if (pq.init(param.max_rows,
                 true,                           // max_at_top
-                NULL,                           // compare_function
+                param.using_packed_sortkeys() ?
+                &compare_packed_sort_keys : NULL, // compare_function
                 compare_length,
                 &make_sortkey, &param, sort->get_sort_keys()))
     {
@@ -305,13 +316,15 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     /*
       Use also the space previously used by string pointers in sort_buffer
       for temporary key storage.
+      With packed sort keys the merge buffers are sized in bytes, in units
+      of the maximum record length, see merge_buffers().
     */
     param.max_keys_per_buffer=((param.max_keys_per_buffer *
                                 (param.rec_length + sizeof(char*))) /
                                param.rec_length - 1);
     maxbuffer--;				// Offset from 0
     if (merge_many_buff(&param,
-                        (uchar*) sort->get_sort_keys(),
+                        sort->get_raw_buf(),
                         buffpek,&maxbuffer,
 			&tempfile))
       goto err;
@@ -319,7 +332,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
 	reinit_io_cache(&tempfile,READ_CACHE,0L,0,0))
       goto err;
     if (merge_index(&param,
-                    (uchar*) sort->get_sort_keys(),
+                    sort->get_raw_buf(),
                     buffpek,
                     maxbuffer,
                     &tempfile,
@@ -365,6 +378,8 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     }
   }
   tracker->report_merge_passes_at_end(thd->query_plan_fsort_passes);
+  tracker->report_parallel_sorts(param.parallel_sorts,
+                                 param.sort_threads_used);
   if (unlikely(error))
   {
     int kill_errno= thd->killed_errno();
@@ -701,7 +716,8 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
   handler *file;
   MY_BITMAP *save_read_set, *save_write_set;
   Item *sort_cond;
-  ha_rows retval;
+  ha_rows retval, rows_written= 0;
+  const bool packed_sortkeys= param->using_packed_sortkeys();
   DBUG_ENTER("find_all_keys");
   DBUG_PRINT("info",("using: %s",
                      (select ? select->quick ? "ranges" : "where":
@@ -756,6 +772,9 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
       goto err;
   }
 
+  if (packed_sortkeys && !pq)
+    fs_info->init_next_record_pointer();
+
   DEBUG_SYNC(thd, "after_index_merge_phase1");
   for (;;)
   {
@@ -815,12 +834,30 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
         pq->push(ref_pos);
         idx= pq->num_elements();
       }
+      else if (packed_sortkeys)
+      {
+        uchar *to;
+        if (!(to= fs_info->get_next_record_pointer(param->rec_length)))
+        {
+          if (write_keys(param, fs_info, idx, buffpek_pointers, tempfile))
+            goto err;
+          rows_written+= MY_MIN(idx, param->max_rows);
+          idx= 0;
+          indexpos++;
+          fs_info->init_next_record_pointer();
+          to= fs_info->get_next_record_pointer(param->rec_length);
+        }
+        make_packed_sortkey(param, to, ref_pos);
+        fs_info->adjust_next_record_pointer(param->get_record_length(to));
+        idx++;
+      }
       else
       {
         if (idx == param->max_keys_per_buffer)
         {
           if (write_keys(param, fs_info, idx, buffpek_pointers, tempfile))
             goto err;
+          rows_written+= MY_MIN(idx, param->max_rows);
 	  idx= 0;
 	  indexpos++;
         }
@@ -858,12 +895,13 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
     file->print_error(error,MYF(ME_ERROR_LOG));
     DBUG_RETURN(HA_POS_ERROR);
   }
-  if (indexpos && idx &&
-      write_keys(param, fs_info, idx, buffpek_pointers, tempfile))
-    DBUG_RETURN(HA_POS_ERROR);			/* purecov: inspected */
-  retval= (my_b_inited(tempfile) ?
-           (ha_rows) (my_b_tell(tempfile)/param->rec_length) :
-           idx);
+  if (indexpos && idx)
+  {
+    if (write_keys(param, fs_info, idx, buffpek_pointers, tempfile))
+      DBUG_RETURN(HA_POS_ERROR);                /* purecov: inspected */
+    rows_written+= MY_MIN(idx, param->max_rows);
+  }
+  retval= my_b_inited(tempfile) ? rows_written : idx;
   DBUG_PRINT("info", ("find_all_keys return %llu", (ulonglong) retval));
   DBUG_RETURN(retval);
 
@@ -899,12 +937,10 @@ static bool
 write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
            IO_CACHE *buffpek_pointers, IO_CACHE *tempfile)
 {
-  size_t rec_length;
   uchar **end;
   BUFFPEK buffpek;
   DBUG_ENTER("write_keys");
 
-  rec_length= param->rec_length;
   uchar **sort_keys= fs_info->get_sort_keys();
 
   fs_info->sort_buffer(param, count);
@@ -922,7 +958,8 @@ write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
     count=(uint) param->max_rows;               /* purecov: inspected */
   buffpek.count=(ha_rows) count;
   for (end=sort_keys+count ; sort_keys != end ; sort_keys++)
-    if (my_b_write(tempfile, (uchar*) *sort_keys, (uint) rec_length))
+    if (my_b_write(tempfile, (uchar*) *sort_keys,
+                   param->get_record_length(*sort_keys)))
       goto err;
   if (my_b_write(buffpek_pointers, (uchar*) &buffpek, sizeof(buffpek)))
     goto err;
@@ -956,6 +993,25 @@ static inline void store_length(uchar *to, uint length, uint pack_length)
 }
 
 
+/**
+  Read length stored by store_length().
+*/
+
+static inline uint read_length(const uchar *from, uint pack_length)
+{
+  switch (pack_length) {
+  case 1:
+    return *from;
+  case 2:
+    return mi_uint2korr(from);
+  case 3:
+    return mi_uint3korr(from);
+  default:
+    return mi_uint4korr(from);
+  }
+}
+
+
 void
 Type_handler_string_result::make_sort_key(uchar *to, Item *item,
                                           const SORT_FIELD_ATTR *sort_field,
@@ -1165,50 +1221,50 @@ Type_handler_real_result::make_sort_key(uchar *to, Item *item,
 }
 
 
-/** Make a sort-key from record. */
+/** Make a sort-key part, return position after it. */
 
-static void make_sortkey(Sort_param *param, uchar *to, uchar *ref_pos)
+static uchar *make_sortkey_part(Sort_param *param, SORT_FIELD *sort_field,
+                                uchar *to)
 {
   Field *field;
-  SORT_FIELD *sort_field;
   uint length;
-
-  for (sort_field=param->local_sortorder ;
-       sort_field != param->end ;
-       sort_field++)
-  {
-    bool maybe_null=0;
-    if ((field=sort_field->field))
-    {						// Field
-      field->make_sort_key(to, sort_field->length);
-      if ((maybe_null = field->maybe_null()))
-        to++;
-    }
-    else
-    {						// Item
-      sort_field->item->type_handler()->make_sort_key(to, sort_field->item,
-                                                      sort_field, param);
-      if ((maybe_null= sort_field->item->maybe_null))
-        to++;
-    }
-    if (sort_field->reverse)
-    {							/* Revers key */
-      if (maybe_null && (to[-1]= !to[-1]))
-      {
-        to+= sort_field->length; // don't waste the time reversing all 0's
-        continue;
-      }
-      length=sort_field->length;
-      while (length--)
-      {
-	*to = (uchar) (~ *to);
-	to++;
-      }
+  bool maybe_null=0;
+  if ((field=sort_field->field))
+  {						// Field
+    field->make_sort_key(to, sort_field->length);
+    if ((maybe_null = field->maybe_null()))
+      to++;
+  }
+  else
+  {						// Item
+    sort_field->item->type_handler()->make_sort_key(to, sort_field->item,
+                                                    sort_field, param);
+    if ((maybe_null= sort_field->item->maybe_null))
+      to++;
+  }
+  if (sort_field->reverse)
+  {							/* Revers key */
+    if (maybe_null && (to[-1]= !to[-1]))
+      return to + sort_field->length; // don't waste the time reversing all 0's
+    length=sort_field->length;
+    while (length--)
+    {
+      *to = (uchar) (~ *to);
+      to++;
     }
-    else
-      to+= sort_field->length;
+    return to;
   }
+  return to + sort_field->length;
+}
 
+
+/**
+  Save addon fields or the record reference after the sort key.
+*/
+
+static void make_sortkey_addons(Sort_param *param, uchar *to, uchar *ref_pos)
+{
+  Field *field;
   if (param->addon_field)
   {
     /* 
@@ -1251,7 +1307,160 @@ static void make_sortkey(Sort_param *param, uchar *to, uchar *ref_pos)
     /* Save filepos last */
     memcpy((uchar*) to, ref_pos, (size_t) param->ref_length);
   }
-  return;
+}
+
+
+/** Make a sort-key from record. */
+
+static void make_sortkey(Sort_param *param, uchar *to, uchar *ref_pos)
+{
+  SORT_FIELD *sort_field;
+
+  if (param->using_packed_sortkeys())
+  {
+    make_packed_sortkey(param, to, ref_pos);
+    return;
+  }
+
+  for (sort_field=param->local_sortorder ;
+       sort_field != param->end ;
+       sort_field++)
+    to= make_sortkey_part(param, sort_field, to);
+
+  make_sortkey_addons(param, to, ref_pos);
+}
+
+
+/**
+  Store a packed key part: a NULL marker if the value can be NULL, then
+  the length of the value and the value itself, cut to sort_field->length
+  bytes. The values are compared with the collation, see
+  compare_packed_sort_keys().
+
+  @return Position after the key part
+*/
+
+static uchar *make_packed_sortkey_part(Sort_param *param,
+                                       SORT_FIELD *sort_field, uchar *to)
+{
+  Field *field= sort_field->field;
+  uchar *value= to + sort_field->maybe_null + sort_field->length_bytes;
+  String tmp((char*) value, sort_field->length, sort_field->cs);
+  String *res;
+
+  if (field)
+    res= field->is_null() ? NULL : field->val_str(&tmp);
+  else
+    res= sort_field->item->str_result(&tmp);
+
+  if (sort_field->maybe_null)
+  {
+    if (!res)
+    {
+      *to++= 0;
+      return to;
+    }
+    *to++= 1;
+  }
+  else if (!res)
+  {
+    DBUG_ASSERT(0);                             // Should not happen
+    store_length(to, 0, sort_field->length_bytes);
+    return to + sort_field->length_bytes;
+  }
+
+  size_t length= res->length();
+  if (length > sort_field->length)
+    length= Well_formed_prefix(sort_field->cs, res->ptr(),
+                               sort_field->length).length();
+  store_length(to, (uint) length, sort_field->length_bytes);
+  to+= sort_field->length_bytes;
+  if (res->ptr() != (char*) to)
+    memmove(to, res->ptr(), length);
+  return to + length;
+}
+
+
+/**
+  Make a packed sort-key from record.
+  Key parts which are not packable are stored as by make_sortkey().
+*/
+
+static void make_packed_sortkey(Sort_param *param, uchar *to, uchar *ref_pos)
+{
+  SORT_FIELD *sort_field;
+  uchar *start= to;
+
+  to+= Sort_param::size_of_length_field;
+  for (sort_field=param->local_sortorder ;
+       sort_field != param->end ;
+       sort_field++)
+  {
+    if (sort_field->length_bytes)
+      to= make_packed_sortkey_part(param, sort_field, to);
+    else
+      to= make_sortkey_part(param, sort_field, to);
+  }
+  int4store(start, (uint32) (to - start));
+
+  make_sortkey_addons(param, to, ref_pos);
+}
+
+
+/**
+  Compare two packed sort keys, see make_packed_sortkey().
+  This is used as qsort2_cmp and queue_compare function.
+*/
+
+int compare_packed_sort_keys(void *sort_param, uchar **a_ptr, uchar **b_ptr)
+{
+  Sort_param *param= (Sort_param*) sort_param;
+  uchar *a= *a_ptr + Sort_param::size_of_length_field;
+  uchar *b= *b_ptr + Sort_param::size_of_length_field;
+  int res;
+
+  for (SORT_FIELD *sort_field= param->local_sortorder ;
+       sort_field != param->end ;
+       sort_field++)
+  {
+    if (!sort_field->length_bytes)
+    {
+      /* Fixed size part, already reversed for DESC */
+      size_t length= sort_field->maybe_null + sort_field->length;
+      if ((res= memcmp(a, b, length)))
+        return res;
+      a+= length;
+      b+= length;
+      continue;
+    }
+    if (sort_field->maybe_null)
+    {
+      if (*a != *b)
+      {
+        res= *a ? 1 : -1;                       // NULL is smallest
+        return sort_field->reverse ? -res : res;
+      }
+      bool is_null= !*a;
+      a++;
+      b++;
+      if (is_null)
+        continue;                               // Both are NULL
+    }
+    uint a_length= read_length(a, sort_field->length_bytes);
+    uint b_length= read_length(b, sort_field->length_bytes);
+    a+= sort_field->length_bytes;
+    b+= sort_field->length_bytes;
+    CHARSET_INFO *cs= sort_field->cs;
+    if ((res= cs->coll->strnncollsp(cs, a, a_length, b, b_length)))
+      return sort_field->reverse ? -res : res;
+    a+= a_length;
+    b+= b_length;
+  }
+  /*
+    As with fixed size keys, the reference to the record is considered
+    as an additional sorted field.
+  */
+  return param->addon_field ? 0 : memcmp(a, b, param->ref_length);
 }
 
 
@@ -1298,14 +1507,13 @@ static void register_used_fields(Sort_param *param)
 static bool save_index(Sort_param *param, uint count,
                        SORT_INFO *table_sort)
 {
-  uint offset,res_length;
+  uint res_length;
   uchar *to;
   DBUG_ENTER("save_index");
   DBUG_ASSERT(table_sort->record_pointers == 0);
 
   table_sort->sort_buffer(param, count);
   res_length= param->res_length;
-  offset= param->rec_length-res_length;
   if (!(to= table_sort->record_pointers= 
         (uchar*) my_malloc(res_length*count,
                            MYF(MY_WME | MY_THREAD_SPECIFIC))))
@@ -1313,7 +1521,7 @@ static bool save_index(Sort_param *param, uint count,
   uchar **sort_keys= table_sort->get_sort_keys();
   for (uchar **end= sort_keys+count ; sort_keys != end ; sort_keys++)
   {
-    memcpy(to, *sort_keys+offset, res_length);
+    memcpy(to, *sort_keys + param->get_sort_length(*sort_keys), res_length);
     to+= res_length;
   }
   DBUG_RETURN(0);
@@ -1444,8 +1652,13 @@ static bool check_if_pq_applicable(Sort_param *param,
         param->addon_field= NULL;
 
         param->res_length= param->ref_length;
-        param->sort_length+= param->ref_length;
-        param->rec_length= param->sort_length;
+        if (param->using_packed_sortkeys())
+          param->rec_length= param->sort_length + param->ref_length;
+        else
+        {
+          param->sort_length+= param->ref_length;
+          param->rec_length= param->sort_length;
+        }
 
         DBUG_RETURN(true);
       }
@@ -1533,6 +1746,54 @@ ulong read_to_buffer(IO_CACHE *fromfile, BUFFPEK *buffpek,
 } /* read_to_buffer */
 
 
+/**
+  Read packed sort keys to buffer.
+  Only whole records are consumed, buffpek->max_keys is the size of the
+  buffer in bytes.
+
+  @retval  Number of bytes read
+           (ulong)-1 if something goes wrong
+*/
+
+static ulong read_packed_to_buffer(IO_CACHE *fromfile, BUFFPEK *buffpek,
+                                   Sort_param *param)
+{
+  ha_rows count= 0;
+  uchar *pos, *end;
+  size_t length;
+
+  if (!buffpek->count)
+    return 0;
+  length= (size_t) MY_MIN((my_off_t) buffpek->max_keys,
+                          fromfile->end_of_file - buffpek->file_pos);
+  if (unlikely(my_b_pread(fromfile, (uchar*) buffpek->base, length,
+                          buffpek->file_pos)))
+    return ((ulong) -1);
+  for (pos= buffpek->base, end= pos + length;
+       count < buffpek->count &&
+       pos + Sort_param::size_of_length_field <= end &&
+       pos + param->get_record_length(pos) <= end;
+       count++)
+    pos+= param->get_record_length(pos);
+  DBUG_ASSERT(count);                   // The buffer fits the longest record
+  length= (size_t) (pos - buffpek->base);
+  buffpek->key= buffpek->base;
+  buffpek->file_pos+= length;
+  buffpek->count-= count;
+  buffpek->mem_count= count;
+  return ((ulong) length);
+} /* read_packed_to_buffer */
+
+
+static inline ulong read_keys_to_buffer(IO_CACHE *fromfile, BUFFPEK *buffpek,
+                                        Sort_param *param)
+{
+  return param->using_packed_sortkeys() ?
+         read_packed_to_buffer(fromfile, buffpek, param) :
+         read_to_buffer(fromfile, buffpek, param->rec_length);
+}
+
+
 /**
   Put all room used by freed buffer to use in adjacent buffer.
 
@@ -1580,6 +1841,10 @@ void reuse_freed_buff(QUEUE *queue, BUFFPEK *reuse, uint key_length)
   @param Tb           Last element in source BUFFPEKs array
   @param flag
 
+  @note
+    With packed sort keys the records are of variable length, and
+    BUFFPEK::max_keys is the size of the buffer in bytes.
+
   @retval
     0      OK
   @retval
@@ -1606,6 +1871,7 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   uchar *src;
   uchar *unique_buff= param->unique_buff;
   const bool killable= !param->not_killable;
+  const bool packed= param->using_packed_sortkeys();
   THD* const thd=current_thd;
   DBUG_ENTER("merge_buffers");
 
@@ -1634,6 +1900,11 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
     cmp= param->compare;
     first_cmp_arg= (void *) &param->cmp_context;
   }
+  else if (packed)
+  {
+    cmp= (qsort2_cmp) compare_packed_sort_keys;
+    first_cmp_arg= (void*) param;
+  }
   else
   {
     cmp= get_ptr_compare(sort_length);
@@ -1645,13 +1916,21 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   for (buffpek= Fb ; buffpek <= Tb ; buffpek++)
   {
     buffpek->base= strpos;
-    buffpek->max_keys= maxcount;
-    bytes_read= read_to_buffer(from_file, buffpek, rec_length);
+    buffpek->max_keys= packed ? maxcount * rec_length : maxcount;
+    bytes_read= read_keys_to_buffer(from_file, buffpek, param);
     if (unlikely(bytes_read == (ulong) -1))
       goto err;					/* purecov: inspected */
 
-    strpos+= bytes_read;
-    buffpek->max_keys= buffpek->mem_count;	// If less data in buffers than expected
+    if (packed)
+    {
+      /* Keep the whole area, the next records may be longer */
+      strpos+= buffpek->max_keys;
+    }
+    else
+    {
+      strpos+= bytes_read;
+      buffpek->max_keys= buffpek->mem_count;	// If less data in buffers than expected
+    }
     queue_insert(&queue, (uchar*) buffpek);
   }
 
@@ -1693,6 +1972,11 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
     {
       buffpek= (BUFFPEK*) queue_top(&queue);
       src= buffpek->key;
+      if (packed)
+      {
+        wr_offset= flag ? param->get_sort_length(src) : 0;
+        wr_len= flag ? res_length : param->get_record_length(src);
+      }
       if (cmp)                                        // Remove duplicates
       {
         if (!(*cmp)(first_cmp_arg, &unique_buff,
@@ -1741,14 +2025,14 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
       }
 
     skip_duplicate:
-      buffpek->key+= rec_length;
+      buffpek->key+= param->get_record_length(buffpek->key);
       if (! --buffpek->mem_count)
       {
-        if (unlikely(!(bytes_read= read_to_buffer(from_file, buffpek,
-                                                  rec_length))))
+        if (unlikely(!(bytes_read= read_keys_to_buffer(from_file, buffpek,
+                                                       param))))
         {
           (void) queue_remove_top(&queue);
-          reuse_freed_buff(&queue, buffpek, rec_length);
+          reuse_freed_buff(&queue, buffpek, packed ? 1 : rec_length);
           break;                        /* One buffer have been removed */
         }
         else if (unlikely(bytes_read == (ulong) -1))
@@ -1760,6 +2044,8 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
   buffpek= (BUFFPEK*) queue_top(&queue);
   buffpek->base= (uchar*) sort_buffer;
   buffpek->max_keys= param->max_keys_per_buffer;
+  if (packed)
+    buffpek->max_keys*= rec_length;
 
   /*
     As we know all entries in the buffer are unique, we only have to
@@ -1801,7 +2087,21 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
       buffpek->count= 0;                        /* Don't read more */
     }
     max_rows-= buffpek->mem_count;
-    if (flag == 0)
+    if (packed)
+    {
+      src= buffpek->key;
+      for (ha_rows i= 0; i < buffpek->mem_count; i++)
+      {
+        uint length= param->get_record_length(src);
+        if (flag == 0 ?
+            my_b_write(to_file, src, length) :
+            my_b_write(to_file, src + param->get_sort_length(src),
+                       res_length))
+          goto err;                           /* purecov: inspected */
+        src+= length;
+      }
+    }
+    else if (flag == 0)
     {
       if (my_b_write(to_file, (uchar*) buffpek->key,
                      (size_t)(rec_length*buffpek->mem_count)))
@@ -1827,8 +2127,8 @@ bool merge_buffers(Sort_param *param, IO_CACHE *from_file,
     }
   }
   while (likely(!(error=
-                  (bytes_read= read_to_buffer(from_file, buffpek,
-                                              rec_length)) == (ulong) -1)) &&
+                  (bytes_read= read_keys_to_buffer(from_file, buffpek,
+                                                   param)) == (ulong) -1)) &&
          bytes_read != 0);
 
 end:
@@ -1947,51 +2247,89 @@ Type_handler_decimal_result::sortlength(THD *thd,
   @param s_length	          Number of items to sort
   @param[out] multi_byte_charset Set to 1 if we are using multi-byte charset
                                  (In which case we have to use strxnfrm())
+  @param[out] packed_sortkeys    Set to 1 if some of the string values are
+                                 stored packed, see make_packed_sortkey()
 
   @note
     sortorder->length is updated for each sort item.
+    String values are packed to their actual length instead of being
+    padded to the maximum. This lets a sort buffer hold many more keys
+    when sorting by long VARCHAR columns with short values.
+    max_sort_length limits the length of the weight string of a value,
+    not the length of the value itself. A value can't be cut at the
+    same place for every collation, so only values whose weight strings
+    always fit into max_sort_length are packed, and they are never cut.
+    Longer ones, and BLOB/TEXT, are stored as weight strings of fixed
+    size as before.
 
   @return
     Total length of sort buffer in bytes
+    With packed sort keys this is the maximum length, including the
+    length of the record.
 */
 
 static uint
 sortlength(THD *thd, SORT_FIELD *sortorder, uint s_length,
-           bool *multi_byte_charset)
+           bool *multi_byte_charset, bool *packed_sortkeys)
 {
   uint length;
   *multi_byte_charset= 0;
+  *packed_sortkeys= 0;
 
   length=0;
   for (; s_length-- ; sortorder++)
   {
     sortorder->suffix_length= 0;
+    sortorder->length_bytes= 0;
     if (sortorder->field)
     {
-      CHARSET_INFO *cs= sortorder->field->sort_charset();
-      sortorder->length= sortorder->field->sort_length();
-      if (use_strnxfrm((cs=sortorder->field->sort_charset())))
-      {
-        *multi_byte_charset= true;
+      Field *field= sortorder->field;
+      CHARSET_INFO *cs= field->sort_charset();
+      sortorder->maybe_null= field->maybe_null();
+      sortorder->cs= cs;
+      sortorder->length= field->sort_length();
+      if (use_strnxfrm(cs))
         sortorder->length= (uint)cs->coll->strnxfrmlen(cs, sortorder->length);
+      if (field->type_handler()->is_packable() &&
+          sortorder->length <= thd->variables.max_sort_length)
+      {
+        sortorder->length= field->field_length;
+        sortorder->length_bytes= 1;             // Set below
       }
-      if (sortorder->field->maybe_null())
-	length++;				// Place for NULL marker
+      else if (use_strnxfrm(cs))
+        *multi_byte_charset= true;
     }
     else
     {
-      sortorder->item->type_handler()->sortlength(thd, sortorder->item,
-                                                  sortorder);
-      if (use_strnxfrm(sortorder->item->collation.collation))
+      Item *item= sortorder->item;
+      sortorder->maybe_null= item->maybe_null;
+      sortorder->cs= item->collation.collation;
+      item->type_handler()->sortlength(thd, item, sortorder);
+      if (item->type_handler()->is_packable() &&
+          item->max_length <= thd->variables.max_sort_length &&
+          sortorder->length <= thd->variables.max_sort_length)
       {
-        *multi_byte_charset= true;
+        sortorder->length= item->max_length;
+        sortorder->suffix_length= 0;
+        sortorder->length_bytes= 1;             // Set below
       }
-      if (sortorder->item->maybe_null)
-	length++;				// Place for NULL marker
+      else if (use_strnxfrm(item->collation.collation))
+        *multi_byte_charset= true;
     }
-    set_if_smaller(sortorder->length, thd->variables.max_sort_length);
+    if (sortorder->maybe_null)
+      length++;                                 // Place for NULL marker
+    if (sortorder->length_bytes)
+    {
+      *packed_sortkeys= true;
+      sortorder->length_bytes= suffix_length(sortorder->length);
+      length+= sortorder->length_bytes;
+    }
+    else
+      set_if_smaller(sortorder->length, thd->variables.max_sort_length);
     length+=sortorder->length;
   }
+  if (*packed_sortkeys)
+    length+= Sort_param::size_of_length_field;
   sortorder->field= (Field*) 0;			// end marker
   DBUG_PRINT("info",("sort_length: %d",length));
   return length;
@@ -149,6 +149,18 @@ class SORT_INFO
   void init_record_pointers()
   { filesort_buffer.init_record_pointers(); }
 
+  void init_next_record_pointer()
+  { filesort_buffer.init_next_record_pointer(); }
+
+  uchar *get_next_record_pointer(uint max_length)
+  { return filesort_buffer.get_next_record_pointer(max_length); }
+
+  void adjust_next_record_pointer(uint length)
+  { filesort_buffer.adjust_next_record_pointer(length); }
+
+  uchar *get_raw_buf()
+  { return filesort_buffer.get_raw_buf(); }
+
   size_t sort_buffer_size() const
   { return filesort_buffer.sort_buffer_size(); }
 
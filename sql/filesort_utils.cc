@@ -18,6 +18,8 @@
 #include "sql_const.h"
 #include "sql_sort.h"
 #include "table.h"
+#include "mysqld.h"                             // key_thread_sort_worker
+#include "sql_plist.h"
 
 
 namespace {
@@ -144,6 +146,9 @@ uchar **Filesort_buffer::alloc_sort_buffer(uint num_records,
   m_record_length= record_length;
   start_of_data= m_idx_array.array() + m_idx_array.size();
   m_start_of_data= reinterpret_cast<uchar*>(start_of_data);
+  m_end_of_pointers= sort_keys + allocated_size / sizeof(uchar*);
+  m_next_rec_ptr= NULL;
+  m_packed_count= 0;
 
   DBUG_RETURN(m_idx_array.array());
 }
@@ -154,24 +159,341 @@ void Filesort_buffer::free_sort_buffer()
   my_free(m_idx_array.array());
   m_idx_array.reset();
   m_start_of_data= NULL;
+  m_next_rec_ptr= NULL;
+  m_packed_count= 0;
 }
 
 
-void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
+/**
+  Sort count keys with the fastest method applicable.
+
+  @param buffer  Scratch space for count pointers, or NULL
+*/
+
+static void sort_keys(const Sort_param *param, uchar **keys, uint count,
+                      uchar **buffer)
 {
   size_t size= param->sort_length;
-  if (count <= 1 || size == 0)
+  if (param->using_packed_sortkeys())
+  {
+    my_qsort2(keys, count, sizeof(uchar*),
+              reinterpret_cast<qsort2_cmp>(compare_packed_sort_keys),
+              (void*) param);
     return;
-  uchar **keys= get_sort_keys();
-  uchar **buffer= NULL;
-  if (radixsort_is_appliccable(count, param->sort_length) &&
-      (buffer= (uchar**) my_malloc(count*sizeof(char*),
-                                   MYF(MY_THREAD_SPECIFIC))))
+  }
+  if (buffer && radixsort_is_appliccable(count, param->sort_length))
   {
     radixsort_for_str_ptr(keys, count, param->sort_length, buffer);
-    my_free(buffer);
     return;
   }
-  
   my_qsort2(keys, count, sizeof(uchar*), get_ptr_compare(size), &size);
 }
+
+
+/**
+  A piece of work for a sort worker thread: either sort 'count' keys
+  starting at 'from', using 'to' as scratch space, or merge the two
+  adjacent sorted runs of 'count' and 'count2' keys starting at 'from'
+  into 'to'.
+*/
+
+struct Sort_slice
+{
+  const Sort_param *param;
+  uchar **from;
+  uchar **to;
+  uint count;
+  uint count2;
+  bool merge;
+  /** Slice is in sort_pool.queue, waiting for a worker */
+  bool queued;
+  /** Number of unfinished slices of the batch this slice belongs to */
+  uint *pending;
+  Sort_slice *next, **prev;
+
+  void set(const Sort_param *param_arg, uchar **from_arg, uchar **to_arg,
+           uint count_arg, uint count2_arg, bool merge_arg)
+  {
+    param= param_arg;
+    from= from_arg;
+    to= to_arg;
+    count= count_arg;
+    count2= count2_arg;
+    merge= merge_arg;
+    queued= false;
+  }
+
+  void run()
+  {
+    if (!merge)
+    {
+      sort_keys(param, from, count, to);
+      return;
+    }
+    uchar **a= from, **a_end= from + count;
+    uchar **b= a_end, **b_end= b + count2;
+    uchar **dst= to;
+    if (param->using_packed_sortkeys())
+    {
+      while (a != a_end && b != b_end)
+        *dst++= compare_packed_sort_keys((void*) param, a, b) <= 0 ? *a++ :
+                                                                     *b++;
+    }
+    else
+    {
+      size_t size= param->sort_length;
+      while (a != a_end && b != b_end)
+        *dst++= memcmp(*a, *b, size) <= 0 ? *a++ : *b++;
+    }
+    if (a != a_end)
+      memcpy(dst, a, (a_end - a) * sizeof(uchar*));
+    else if (b != b_end)
+      memcpy(dst, b, (b_end - b) * sizeof(uchar*));
+  }
+};
+
+
+/**
+  Sort worker threads. They are shared by all connections, created on
+  demand up to MAX_SORT_THREADS - 1 threads and kept until shutdown.
+*/
+
+static struct
+{
+  /** Protects all members and Sort_slice::queued, Sort_slice::pending */
+  mysql_mutex_t lock;
+  /** Signalled when slices are queued or on shutdown */
+  mysql_cond_t cond_work;
+  /** Signalled when a queued slice is done or a worker exits */
+  mysql_cond_t cond_done;
+  I_P_List<Sort_slice, I_P_List_adapter<Sort_slice, &Sort_slice::next,
+                                        &Sort_slice::prev>,
+           I_P_List_null_counter, I_P_List_fast_push_back<Sort_slice> >
+    queue;
+  pthread_t thread_ids[MAX_SORT_THREADS - 1];
+  uint threads;
+  uint idle;
+  bool shutdown;
+  bool inited;
+} sort_pool;
+
+#ifdef HAVE_PSI_INTERFACE
+static PSI_mutex_key key_LOCK_sort_pool;
+static PSI_mutex_info all_sort_pool_mutexes[]=
+{
+  { &key_LOCK_sort_pool, "LOCK_sort_pool", PSI_FLAG_GLOBAL }
+};
+
+static PSI_cond_key key_COND_sort_pool_work, key_COND_sort_pool_done;
+static PSI_cond_info all_sort_pool_conds[]=
+{
+  { &key_COND_sort_pool_work, "COND_sort_pool_work", PSI_FLAG_GLOBAL },
+  { &key_COND_sort_pool_done, "COND_sort_pool_done", PSI_FLAG_GLOBAL }
+};
+#endif
+
+
+void init_sort_threads()
+{
+#ifdef HAVE_PSI_INTERFACE
+  mysql_mutex_register("sql", all_sort_pool_mutexes,
+                       array_elements(all_sort_pool_mutexes));
+  mysql_cond_register("sql", all_sort_pool_conds,
+                      array_elements(all_sort_pool_conds));
+#endif
+  mysql_mutex_init(key_LOCK_sort_pool, &sort_pool.lock, MY_MUTEX_INIT_FAST);
+  mysql_cond_init(key_COND_sort_pool_work, &sort_pool.cond_work, NULL);
+  mysql_cond_init(key_COND_sort_pool_done, &sort_pool.cond_done, NULL);
+  sort_pool.queue.empty();
+  sort_pool.threads= 0;
+  sort_pool.idle= 0;
+  sort_pool.shutdown= false;
+  sort_pool.inited= true;
+}
+
+
+/**
+  Stop all sort worker threads. No sort may be in progress.
+*/
+
+void end_sort_threads()
+{
+  if (!sort_pool.inited)
+    return;
+  mysql_mutex_lock(&sort_pool.lock);
+  DBUG_ASSERT(sort_pool.queue.is_empty());
+  sort_pool.shutdown= true;
+  mysql_cond_broadcast(&sort_pool.cond_work);
+  mysql_mutex_unlock(&sort_pool.lock);
+  for (uint i= 0; i < sort_pool.threads; i++)
+    pthread_join(sort_pool.thread_ids[i], NULL);
+  mysql_cond_destroy(&sort_pool.cond_done);
+  mysql_cond_destroy(&sort_pool.cond_work);
+  mysql_mutex_destroy(&sort_pool.lock);
+  sort_pool.inited= false;
+}
+
+
+pthread_handler_t sort_worker_thread(void *)
+{
+  my_thread_init();
+  mysql_mutex_lock(&sort_pool.lock);
+  for (;;)
+  {
+    Sort_slice *slice;
+    while (!(slice= sort_pool.queue.pop_front()) && !sort_pool.shutdown)
+    {
+      sort_pool.idle++;
+      mysql_cond_wait(&sort_pool.cond_work, &sort_pool.lock);
+      sort_pool.idle--;
+    }
+    if (!slice)
+      break;
+    slice->queued= false;
+    mysql_mutex_unlock(&sort_pool.lock);
+    slice->run();
+    mysql_mutex_lock(&sort_pool.lock);
+    if (!--*slice->pending)
+      mysql_cond_broadcast(&sort_pool.cond_done);
+  }
+  mysql_mutex_unlock(&sort_pool.lock);
+  my_thread_end();
+  return 0;
+}
+
+
+/**
+  Run the slices in parallel: queue all but the first one for the sort
+  workers, starting new workers if there are not enough idle ones, and
+  run the first one in the current thread. Slices that no worker has
+  picked up by then are run in the current thread as well.
+*/
+
+static void run_sort_slices(Sort_slice *slices, uint count)
+{
+  uint pending= count - 1;
+
+  mysql_mutex_lock(&sort_pool.lock);
+  DBUG_ASSERT(sort_pool.inited && !sort_pool.shutdown);
+  for (uint i= 1; i < count; i++)
+  {
+    slices[i].queued= true;
+    slices[i].pending= &pending;
+    sort_pool.queue.push_back(slices + i);
+  }
+  for (uint idle= sort_pool.idle;
+       idle < pending && sort_pool.threads < MAX_SORT_THREADS - 1; idle++)
+  {
+    if (mysql_thread_create(key_thread_sort_worker,
+                            &sort_pool.thread_ids[sort_pool.threads], NULL,
+                            sort_worker_thread, NULL))
+      break;
+    sort_pool.threads++;
+  }
+  mysql_cond_broadcast(&sort_pool.cond_work);
+  mysql_mutex_unlock(&sort_pool.lock);
+
+  slices[0].run();
+
+  mysql_mutex_lock(&sort_pool.lock);
+  for (uint i= 1; i < count; i++)
+  {
+    if (!slices[i].queued)
+      continue;
+    sort_pool.queue.remove(slices + i);
+    slices[i].queued= false;
+    mysql_mutex_unlock(&sort_pool.lock);
+    slices[i].run();
+    mysql_mutex_lock(&sort_pool.lock);
+    pending--;
+  }
+  while (pending)
+    mysql_cond_wait(&sort_pool.cond_done, &sort_pool.lock);
+  mysql_mutex_unlock(&sort_pool.lock);
+}
+
+
+/**
+  Sort the keys by splitting them into 'threads' slices that are sorted in
+  parallel, and then merging adjacent pairs of sorted runs in parallel until
+  a single run is left.
+
+  @retval false  OK
+  @retval true   Out of memory, nothing was done
+*/
+
+static bool parallel_sort(Sort_param *param, uchar **keys, uint count,
+                          uint threads)
+{
+  Sort_slice slices[MAX_SORT_THREADS];
+  uint run_start[MAX_SORT_THREADS], run_count[MAX_SORT_THREADS];
+  uint slice_keys= count / threads;
+  uint runs;
+  uchar **buffer, **from, **to;
+  DBUG_ENTER("parallel_sort");
+  DBUG_ASSERT(threads > 1 && threads <= MAX_SORT_THREADS);
+
+  if (!(buffer= (uchar**) my_malloc(count * sizeof(uchar*),
+                                    MYF(MY_THREAD_SPECIFIC))))
+    DBUG_RETURN(true);
+
+  for (runs= 0; runs < threads; runs++)
+  {
+    run_start[runs]= runs * slice_keys;
+    run_count[runs]= runs == threads - 1 ? count - run_start[runs] :
+                                           slice_keys;
+    slices[runs].set(param, keys + run_start[runs], buffer + run_start[runs],
+                     run_count[runs], 0, false);
+  }
+  run_sort_slices(slices, threads);
+
+  for (from= keys, to= buffer; runs > 1; std::swap(from, to))
+  {
+    uint merges= 0;
+    for (uint i= 0; i + 1 < runs; i+= 2, merges++)
+    {
+      slices[merges].set(param, from + run_start[i], to + run_start[i],
+                         run_count[i], run_count[i + 1], true);
+      run_start[merges]= run_start[i];
+      run_count[merges]= run_count[i] + run_count[i + 1];
+    }
+    if (runs & 1)
+    {
+      /* The odd run out is carried over to the next round as it is */
+      memcpy(to + run_start[runs - 1], from + run_start[runs - 1],
+             run_count[runs - 1] * sizeof(uchar*));
+      run_start[merges]= run_start[runs - 1];
+      run_count[merges]= run_count[runs - 1];
+    }
+    run_sort_slices(slices, merges);
+    runs= merges + (runs & 1);
+  }
+  if (from != keys)
+    memcpy(keys, from, count * sizeof(uchar*));
+  my_free(buffer);
+
+  param->parallel_sorts++;
+  set_if_bigger(param->sort_threads_used, threads);
+  DBUG_PRINT("info", ("sorted %u keys in %u slices", count, threads));
+  DBUG_RETURN(false);
+}
+
+
+void Filesort_buffer::sort_buffer(Sort_param *param, uint count)
+{
+  size_t size= param->sort_length;
+  if (count <= 1 || size == 0)
+    return;
+  uchar **keys= get_sort_keys();
+  uchar **buffer= NULL;
+  uint threads= MY_MIN(param->max_sort_threads,
+                       count / MIN_KEYS_PER_SORT_THREAD);
+  if (threads > 1 && !parallel_sort(param, keys, count, threads))
+    return;
+
+  if (!param->using_packed_sortkeys() &&
+      radixsort_is_appliccable(count, param->sort_length))
+    buffer= (uchar**) my_malloc(count*sizeof(char*), MYF(MY_THREAD_SPECIFIC));
+  sort_keys(param, keys, count, buffer);
+  my_free(buffer);
+}
@@ -20,6 +20,10 @@
 #include "sql_array.h"
 
 class Sort_param;
+
+void init_sort_threads();
+void end_sort_threads();
+
 /*
   Calculate cost of merge sort
 
@@ -60,7 +64,8 @@ class Filesort_buffer
 {
 public:
   Filesort_buffer()
-    : m_idx_array(), m_start_of_data(NULL), allocated_size(0)
+    : m_idx_array(), m_start_of_data(NULL), allocated_size(0),
+      m_next_rec_ptr(NULL), m_end_of_pointers(NULL), m_packed_count(0)
   {}
   
   ~Filesort_buffer()
@@ -75,10 +80,12 @@ class Filesort_buffer
   void reset()
   {
     m_idx_array.reset();
+    m_next_rec_ptr= NULL;
+    m_packed_count= 0;
   }
 
   /** Sort me... */
-  void sort_buffer(const Sort_param *param, uint count);
+  void sort_buffer(Sort_param *param, uint count);
 
   /// Initializes a record pointer.
   uchar *get_record_buffer(uint idx)
@@ -94,6 +101,39 @@ class Filesort_buffer
       (void) get_record_buffer(ix);
   }
 
+  /**
+    Packed sort keys are of variable length, so they cannot be stored in
+    fixed size slots. Instead the records are appended from the start of
+    the buffer and the pointers to them are prepended from the end of it,
+    until the two meet.
+  */
+  void init_next_record_pointer()
+  {
+    m_next_rec_ptr= reinterpret_cast<uchar*>(m_idx_array.array());
+    m_packed_count= 0;
+  }
+
+  /// Space for a packed record of at most max_length, NULL if buffer is full.
+  uchar *get_next_record_pointer(uint max_length)
+  {
+    uchar **end= m_end_of_pointers - m_packed_count - 1;
+    return m_next_rec_ptr + max_length <= reinterpret_cast<uchar*>(end) ?
+           m_next_rec_ptr : NULL;
+  }
+
+  /// Adds the packed record of 'length' bytes at get_next_record_pointer().
+  void adjust_next_record_pointer(uint length)
+  {
+    *(m_end_of_pointers - ++m_packed_count)= m_next_rec_ptr;
+    m_next_rec_ptr+= length;
+  }
+
+  /// Start of the buffer, for using it as raw memory when merging.
+  uchar *get_raw_buf()
+  {
+    return reinterpret_cast<uchar*>(m_idx_array.array());
+  }
+
   /// Returns total size: pointer array + record buffers.
   size_t sort_buffer_size() const
   {
@@ -107,7 +147,11 @@ class Filesort_buffer
   void free_sort_buffer();
 
   /// Getter, for calling routines which still use the uchar** interface.
-  uchar **get_sort_keys() { return m_idx_array.array(); }
+  uchar **get_sort_keys()
+  {
+    return m_next_rec_ptr ? m_end_of_pointers - m_packed_count :
+                            m_idx_array.array();
+  }
 
   /**
     We need an assignment operator, see filesort().
@@ -121,6 +165,9 @@ class Filesort_buffer
     m_record_length= rhs.m_record_length;
     m_start_of_data= rhs.m_start_of_data;
     allocated_size=  rhs.allocated_size;
+    m_next_rec_ptr=  rhs.m_next_rec_ptr;
+    m_end_of_pointers= rhs.m_end_of_pointers;
+    m_packed_count=  rhs.m_packed_count;
     return *this;
   }
 
@@ -131,6 +178,10 @@ class Filesort_buffer
   uint       m_record_length;
   uchar     *m_start_of_data;                   /* Start of key data */
   size_t    allocated_size;
+  /* The fields below are only used for packed sort keys */
+  uchar     *m_next_rec_ptr;                    /* Where next record goes */
+  uchar    **m_end_of_pointers;                 /* End of the buffer */
+  uint       m_packed_count;                    /* Number of records */
 };
 
 #endif  // FILESORT_UTILS_INCLUDED
@@ -2376,6 +2376,7 @@ void Item_sum_min_max::clear()
   DBUG_ENTER("Item_sum_min_max::clear");
   value->clear();
   null_value= 1;
+  window_values_first= window_values_count= 0;
   DBUG_VOID_RETURN;
 }
 
@@ -2479,6 +2480,10 @@ void Item_sum_min_max::cleanup()
     If some results found it will be left unchanged.
   */
   was_values= TRUE;
+  /* The ring buffer was allocated on the execution memory root */
+  sliding_window= FALSE;
+  window_values= 0;
+  window_values_size= 0;
   DBUG_VOID_RETURN;
 }
 
@@ -2505,6 +2510,139 @@ void Item_sum_min_max::restore_to_before_no_rows_in_result()
 }
 
 
+/*
+  MIN() and MAX() can only be updated incrementally when values leave the
+  frame in the order they entered it. This holds when the frame starts at
+  or before the current row and ends at or after it. Frames starting with
+  UNBOUNDED PRECEDING never remove values and need no ring buffer.
+*/
+
+void Item_sum_min_max::setup_window_func(THD *thd, Window_spec *window_spec)
+{
+  Window_frame *frame= window_spec->window_frame;
+  sliding_window= frame &&
+    (frame->top_bound->precedence_type == Window_frame_bound::CURRENT ||
+     (frame->top_bound->precedence_type == Window_frame_bound::PRECEDING &&
+      !frame->top_bound->is_unbounded())) &&
+    frame->bottom_bound->precedence_type != Window_frame_bound::PRECEDING;
+  window_values_first= window_values_count= 0;
+}
+
+
+/**
+  Double the size of the ring buffer of a sliding window.
+
+  @retval false  ok
+  @retval true   out of memory
+*/
+
+bool Item_sum_min_max::grow_window()
+{
+  uint size= window_values_size ? window_values_size * 2 : 16;
+  Item_cache **values= (Item_cache**) current_thd->calloc(size *
+                                                          sizeof(Item_cache*));
+  if (!values)
+    return true;
+  for (uint i= 0; i < window_values_size; i++)
+    values[i]= window_values[(window_values_first + i) &
+                             (window_values_size - 1)];
+  window_values= values;
+  window_values_size= size;
+  window_values_first= 0;
+  return false;
+}
+
+
+/** Make the first value of a sliding window the result. */
+
+void Item_sum_min_max::set_window_result()
+{
+  value->store(window_values[window_values_first]);
+  value->cache_value();
+  null_value= 0;
+}
+
+
+/**
+  Add the current value of the argument to a sliding window.
+
+  The values that are worse than the new one are dropped from the end of
+  the ring buffer, as they can never become the result again.
+*/
+
+bool Item_sum_min_max::add_to_window()
+{
+  Item_cache *result= value;
+  Item_cache **slot;
+
+  arg_cache->cache_value();
+  if (arg_cache->null_value)
+    return false;
+
+  while (window_values_count)
+  {
+    /* Compare with the last value; cmp compares arg_cache with value */
+    value= window_values[(window_values_first + window_values_count - 1) &
+                         (window_values_size - 1)];
+    int res= cmp->compare() * cmp_sign;
+    value= result;
+    if (res >= 0)
+      break;
+    window_values_count--;
+  }
+
+  if (window_values_count == window_values_size && grow_window())
+    return true;
+
+  slot= &window_values[(window_values_first + window_values_count) &
+                       (window_values_size - 1)];
+  if (!*slot)
+  {
+    THD *thd= current_thd;
+    if (!(*slot= args[0]->get_cache(thd)))
+      return true;
+    (*slot)->setup(thd, args[0]);
+    (*slot)->set_used_tables(RAND_TABLE_BIT);
+  }
+  (*slot)->store(arg_cache);
+  (*slot)->cache_value();
+
+  if (!window_values_count++)
+    set_window_result();
+  return false;
+}
+
+
+/**
+  Remove the current value of the argument from a sliding window.
+
+  Values leave the frame in the order they were added, so the value is
+  either the first one in the ring buffer, or it was dropped already.
+*/
+
+void Item_sum_min_max::remove()
+{
+  Item_cache *result= value;
+  DBUG_ASSERT(sliding_window);
+
+  arg_cache->cache_value();
+  if (arg_cache->null_value || !window_values_count)
+    return;
+
+  value= window_values[window_values_first];
+  int res= cmp->compare();
+  value= result;
+  if (res)
+    return;
+
+  window_values_first= (window_values_first + 1) & (window_values_size - 1);
+  if (--window_values_count)
+    set_window_result();
+  else
+    clear();
+}
+
+
 Item *Item_sum_min::copy_or_same(THD* thd)
 {
   DBUG_ENTER("Item_sum_min::copy_or_same");
@@ -2520,6 +2658,9 @@ bool Item_sum_min::add()
   DBUG_ENTER("Item_sum_min::add");
   DBUG_PRINT("enter", ("this: %p", this));
 
+  if (sliding_window)
+    DBUG_RETURN(add_to_window());
+
   if (unlikely(direct_added))
   {
     /* Change to use direct_item */
@@ -2560,6 +2701,9 @@ bool Item_sum_max::add()
   DBUG_ENTER("Item_sum_max::add");
   DBUG_PRINT("enter", ("this: %p", this));
 
+  if (sliding_window)
+    DBUG_RETURN(add_to_window());
+
   if (unlikely(direct_added))
   {
     /* Change to use direct_item */
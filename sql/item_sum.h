@@ -1084,17 +1084,35 @@ class Item_sum_min_max :public Item_sum_hybrid
   int cmp_sign;
   bool was_values;  // Set if we have found at least one row (for max/min only)
   bool was_null_value;
+  /*
+    Set if the function is computed over a sliding window frame. Then
+    window_values is a ring buffer of the values of the frame that can
+    still become the result, in the order they were added: each of them
+    is better than all the values added after it. The first one is the
+    result.
+  */
+  bool sliding_window;
+  Item_cache **window_values;
+  uint window_values_size;       // allocated size, a power of 2
+  uint window_values_first;
+  uint window_values_count;
+
+  bool add_to_window();
+  bool grow_window();
+  void set_window_result();
 
 public:
   Item_sum_min_max(THD *thd, Item *item_par,int sign):
     Item_sum_hybrid(thd, item_par),
     direct_added(FALSE), value(0), arg_cache(0), cmp(0),
-    cmp_sign(sign), was_values(TRUE)
+    cmp_sign(sign), was_values(TRUE), sliding_window(FALSE),
+    window_values(0), window_values_size(0)
   { collation.set(&my_charset_bin); }
   Item_sum_min_max(THD *thd, Item_sum_min_max *item)
     :Item_sum_hybrid(thd, item),
     direct_added(FALSE), value(item->value), arg_cache(0),
-    cmp_sign(item->cmp_sign), was_values(item->was_values)
+    cmp_sign(item->cmp_sign), was_values(item->was_values),
+    sliding_window(FALSE), window_values(0), window_values_size(0)
   { }
   bool fix_fields(THD *, Item **);
   bool fix_length_and_dec();
@@ -1125,6 +1143,9 @@ class Item_sum_min_max :public Item_sum_hybrid
   void restore_to_before_no_rows_in_result();
   Field *create_tmp_field(MEM_ROOT *root, bool group, TABLE *table);
   void setup_caches(THD *thd) { setup_hybrid(thd, arguments()[0], NULL); }
+  void setup_window_func(THD *thd, Window_spec *window_spec);
+  bool supports_removal() const { return sliding_window; }
+  void remove();
 };
 
 
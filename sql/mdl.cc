@@ -26,10 +26,12 @@
 #include <mysql/psi/mysql_stage.h>
 #ifdef HAVE_PSI_INTERFACE
 static PSI_mutex_key key_MDL_wait_LOCK_wait_status;
+static PSI_mutex_key key_MDL_lock_LOCK_fast_path;
 
 static PSI_mutex_info all_mdl_mutexes[]=
 {
-  { &key_MDL_wait_LOCK_wait_status, "MDL_wait::LOCK_wait_status", 0}
+  { &key_MDL_wait_LOCK_wait_status, "MDL_wait::LOCK_wait_status", 0},
+  { &key_MDL_lock_LOCK_fast_path, "MDL_lock::LOCK_fast_path", 0}
 };
 
 static PSI_rwlock_key key_MDL_lock_rwlock;
@@ -154,6 +156,8 @@ class MDL_map
   void init();
   void destroy();
   MDL_lock *find_or_insert(LF_PINS *pins, const MDL_key *key);
+  bool add_fast_path_ticket(LF_PINS *pins, const MDL_key *key,
+                            MDL_ticket *ticket);
   unsigned long get_lock_owner(LF_PINS *pins, const MDL_key *key);
   void remove(LF_PINS *pins, MDL_lock *lock);
   LF_PINS *get_pins() { return lf_hash_get_pins(&m_locks); }
@@ -308,6 +312,9 @@ Deadlock_detection_visitor::opt_change_victim_to(MDL_context *new_victim)
   and compatibility matrices.
 */
 
+/** Number of fast path shards per MDL_lock object. */
+#define MDL_FAST_PATH_SHARDS 8
+
 /**
   The lock context. Created internally for an acquired lock.
   For a given name, there exists only one MDL_lock instance,
@@ -367,6 +374,11 @@ class MDL_lock
     virtual bool needs_notification(const MDL_ticket *ticket) const = 0;
     virtual bool conflicting_locks(const MDL_ticket *ticket) const = 0;
     virtual bitmap_t hog_lock_types_bitmap() const = 0;
+    /**
+      Unobtrusive lock types, which are compatible with each other and
+      can be granted through the fast path (see Fast_path_shard).
+    */
+    virtual bitmap_t fast_path_types_bitmap() const = 0;
     virtual ~MDL_lock_strategy() {}
   };
 
@@ -403,6 +415,13 @@ class MDL_lock
     */
     virtual bitmap_t hog_lock_types_bitmap() const
     { return 0; }
+
+    /*
+      Scoped locks are taken by DDL statements only, so they are left on
+      the slow path.
+    */
+    virtual bitmap_t fast_path_types_bitmap() const
+    { return 0; }
   private:
     static const bitmap_t m_granted_incompatible[MDL_TYPE_END];
     static const bitmap_t m_waiting_incompatible[MDL_TYPE_END];
@@ -451,6 +470,18 @@ class MDL_lock
               MDL_BIT(MDL_EXCLUSIVE));
     }
 
+    /*
+      Locks taken by DML and by metadata readers. They conflict only with
+      SU, SRO, SNW, SNRW and X, and they never have to wait for each other.
+    */
+    virtual bitmap_t fast_path_types_bitmap() const
+    {
+      return (MDL_BIT(MDL_SHARED) |
+              MDL_BIT(MDL_SHARED_HIGH_PRIO) |
+              MDL_BIT(MDL_SHARED_READ) |
+              MDL_BIT(MDL_SHARED_WRITE));
+    }
+
   private:
     static const bitmap_t m_granted_incompatible[MDL_TYPE_END];
     static const bitmap_t m_waiting_incompatible[MDL_TYPE_END];
@@ -488,6 +519,13 @@ class MDL_lock
     */
     virtual bitmap_t hog_lock_types_bitmap() const
     { return 0; }
+
+    /*
+      BACKUP namespace has its own compatibility rules and its locks are
+      not covered by the fast path yet.
+    */
+    virtual bitmap_t fast_path_types_bitmap() const
+    { return 0; }
   private:
     static const bitmap_t m_granted_incompatible[MDL_BACKUP_END];
     static const bitmap_t m_waiting_incompatible[MDL_BACKUP_END];
@@ -531,6 +569,10 @@ class MDL_lock
   */
   mysql_prlock_t m_rwlock;
 
+  /**
+    Check if there are no slow path tickets.
+    Tickets in fast path shards are checked by close_fast_path().
+  */
   bool is_empty() const
   {
     return (m_granted.is_empty() && m_waiting.is_empty());
@@ -546,7 +588,7 @@ class MDL_lock
   bool can_grant_lock(enum_mdl_type type, MDL_context *requstor_ctx,
                       bool ignore_lock_priority) const;
 
-  inline unsigned long get_lock_owner() const;
+  inline unsigned long get_lock_owner();
 
   void reschedule_waiters();
 
@@ -579,6 +621,16 @@ class MDL_lock
   bitmap_t hog_lock_types_bitmap() const
   { return m_strategy->hog_lock_types_bitmap(); }
 
+  bitmap_t fast_path_types_bitmap() const
+  { return m_strategy->fast_path_types_bitmap(); }
+
+  bool add_fast_path_ticket(MDL_ticket *ticket);
+  bool remove_fast_path_ticket(LF_PINS *pins, MDL_ticket *ticket);
+  void materialize_fast_path_ticket(MDL_ticket *ticket);
+  void block_fast_path();
+  void unblock_fast_path();
+  bool close_fast_path();
+
 #ifndef DBUG_OFF
   bool check_if_conflicting_replication_locks(MDL_context *ctx);
 #endif
@@ -594,24 +646,105 @@ class MDL_lock
   */
   ulong m_hog_lock_count;
 
+  /**
+    A shard of the fast path for unobtrusive locks.
+
+    Unobtrusive lock types (see MDL_lock_strategy::fast_path_types_bitmap())
+    are compatible with each other and with everything but obtrusive locks.
+    As long as there are no obtrusive locks granted or pending, such
+    requests are granted by adding the ticket to the shard of the
+    requesting context, under LOCK_fast_path instead of m_rwlock.
+
+    An obtrusive request calls block_fast_path(), which moves tickets of
+    all shards to m_granted and makes further requests use the slow path.
+    Thus conflict checks, deadlock detector and notification of lock
+    owners only ever have to look at m_granted. Shards are reopened by
+    unblock_fast_path() when the last obtrusive ticket is gone.
+
+    A fast path request or release writes only the shard of its context.
+    All shards are looked at under their mutexes only by block_fast_path()
+    and close_fast_path().
+  */
+  struct Fast_path_shard
+  {
+    /** Protects the members below and MDL_ticket::m_is_fast_path. */
+    mysql_mutex_t LOCK_fast_path;
+    /** Tickets granted through this shard. */
+    Ticket_list m_tickets;
+    /**
+      Number of tickets in m_tickets. Changed under LOCK_fast_path,
+      read without it by remove_fast_path_ticket().
+    */
+    std::atomic<uint32_t> m_n_tickets;
+    /** Whether tickets can't be added to this shard. */
+    bool m_blocked;
+    /** Avoid false sharing between shards */
+    char pad[CPU_LEVEL1_DCACHE_LINESIZE];
+  };
+
+  Fast_path_shard m_fast_path[MDL_FAST_PATH_SHARDS];
+
+  /**
+    Whether the shards were blocked by block_fast_path() or closed by
+    close_fast_path(). Protected by m_rwlock.
+  */
+  bool m_fast_path_blocked;
+
 public:
 
   MDL_lock()
     : m_hog_lock_count(0),
+      m_fast_path_blocked(false),
       m_strategy(0)
-  { mysql_prlock_init(key_MDL_lock_rwlock, &m_rwlock); }
+  {
+    mysql_prlock_init(key_MDL_lock_rwlock, &m_rwlock);
+    init_fast_path();
+  }
 
   MDL_lock(const MDL_key *key_arg)
   : key(key_arg),
     m_hog_lock_count(0),
+    m_fast_path_blocked(false),
     m_strategy(&m_backup_lock_strategy)
   {
     DBUG_ASSERT(key_arg->mdl_namespace() == MDL_key::BACKUP);
     mysql_prlock_init(key_MDL_lock_rwlock, &m_rwlock);
+    init_fast_path();
   }
 
   ~MDL_lock()
-  { mysql_prlock_destroy(&m_rwlock); }
+  {
+    for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+    {
+      DBUG_ASSERT(m_fast_path[i].m_tickets.is_empty());
+      DBUG_ASSERT(!m_fast_path[i].m_n_tickets);
+      mysql_mutex_destroy(&m_fast_path[i].LOCK_fast_path);
+    }
+    mysql_prlock_destroy(&m_rwlock);
+  }
+
+  void init_fast_path()
+  {
+    for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+    {
+      mysql_mutex_init(key_MDL_lock_LOCK_fast_path,
+                       &m_fast_path[i].LOCK_fast_path, MY_MUTEX_INIT_FAST);
+      m_fast_path[i].m_n_tickets= 0;
+      m_fast_path[i].m_blocked= false;
+    }
+  }
+
+  static const MDL_lock_strategy *get_strategy(const MDL_key *key_arg)
+  {
+    switch (key_arg->mdl_namespace()) {
+    case MDL_key::BACKUP:
+      return &m_backup_lock_strategy;
+    case MDL_key::SCHEMA:
+      return &m_scoped_lock_strategy;
+    default:
+      return &m_object_lock_strategy;
+    }
+  }
 
   static void lf_alloc_constructor(uchar *arg)
   { new (arg + LF_HASH_OVERHEAD) MDL_lock(); }
@@ -624,10 +757,14 @@ class MDL_lock
   {
     DBUG_ASSERT(key_arg->mdl_namespace() != MDL_key::BACKUP);
     new (&lock->key) MDL_key(key_arg);
-    if (key_arg->mdl_namespace() == MDL_key::SCHEMA)
-      lock->m_strategy= &m_scoped_lock_strategy;
-    else
-      lock->m_strategy= &m_object_lock_strategy;
+    /*
+      The object is not visible to other threads yet, so shards closed by
+      a previous close_fast_path() can be reopened without LOCK_fast_path.
+    */
+    lock->m_fast_path_blocked= false;
+    for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+      lock->m_fast_path[i].m_blocked= false;
+    lock->m_strategy= get_strategy(key_arg);
   }
 
   const MDL_lock_strategy *m_strategy;
@@ -720,6 +857,15 @@ static my_bool mdl_iterate_lock(MDL_lock *lock, mdl_iterate_arg *arg)
   MDL_ticket *ticket;
   while ((ticket= granted_it++) && !(res= arg->callback(ticket, arg->argument, true)))
     /* no-op */;
+  for (uint i= 0; i < MDL_FAST_PATH_SHARDS && !res; i++)
+  {
+    MDL_lock::Fast_path_shard *shard= &lock->m_fast_path[i];
+    mysql_mutex_lock(&shard->LOCK_fast_path);
+    MDL_lock::Ticket_iterator fast_path_it(shard->m_tickets);
+    while ((ticket= fast_path_it++) && !(res= arg->callback(ticket, arg->argument, true)))
+      /* no-op */;
+    mysql_mutex_unlock(&shard->LOCK_fast_path);
+  }
   while ((ticket= waiting_it++) && !(res= arg->callback(ticket, arg->argument, false)))
     /* no-op */;
   mysql_prlock_unlock(&lock->m_rwlock);
@@ -830,6 +976,38 @@ MDL_lock* MDL_map::find_or_insert(LF_PINS *pins, const MDL_key *mdl_key)
 }
 
 
+/**
+  Find MDL_lock object corresponding to the key, create it if it does
+  not exist, and try to grant unobtrusive lock through its fast path.
+
+  @retval TRUE  - Success. The ticket was added to a fast path shard.
+  @retval FALSE - Fast path is blocked or out of memory. The request
+                  must go through find_or_insert().
+*/
+
+bool MDL_map::add_fast_path_ticket(LF_PINS *pins, const MDL_key *mdl_key,
+                                   MDL_ticket *ticket)
+{
+  MDL_lock *lock;
+  bool res;
+
+  DBUG_ASSERT(mdl_key->mdl_namespace() != MDL_key::BACKUP);
+
+  while (!(lock= (MDL_lock*) lf_hash_search(&m_locks, pins, mdl_key->ptr(),
+                                            mdl_key->length())))
+    if (lf_hash_insert(&m_locks, pins, (uchar*) mdl_key) == -1)
+      return false;
+
+  /*
+    The pin keeps the object from being reused. If it was removed from
+    the hash meanwhile, its shards are closed and the slow path retries.
+  */
+  res= lock->add_fast_path_ticket(ticket);
+  lf_hash_search_unpin(pins);
+  return res;
+}
+
+
 /**
  * Return thread id of the owner of the lock, if it is owned.
  */
@@ -1791,14 +1969,24 @@ MDL_lock::can_grant_lock(enum_mdl_type type_arg,
 */
 
 inline unsigned long
-MDL_lock::get_lock_owner() const
+MDL_lock::get_lock_owner()
 {
   Ticket_iterator it(m_granted);
   MDL_ticket *ticket;
+  unsigned long res= 0;
 
   if ((ticket= it++))
     return ticket->get_ctx()->get_thread_id();
-  return 0;
+
+  for (uint i= 0; i < MDL_FAST_PATH_SHARDS && !res; i++)
+  {
+    mysql_mutex_lock(&m_fast_path[i].LOCK_fast_path);
+    Ticket_iterator fast_path_it(m_fast_path[i].m_tickets);
+    if ((ticket= fast_path_it++))
+      res= ticket->get_ctx()->get_thread_id();
+    mysql_mutex_unlock(&m_fast_path[i].LOCK_fast_path);
+  }
+  return res;
 }
 
 
@@ -1809,7 +1997,7 @@ void MDL_lock::remove_ticket(LF_PINS *pins, Ticket_list MDL_lock::*list,
 {
   mysql_prlock_wrlock(&m_rwlock);
   (this->*list).remove_ticket(ticket);
-  if (is_empty())
+  if (is_empty() && close_fast_path())
     mdl_locks.remove(pins, this);
   else
   {
@@ -1828,11 +2016,233 @@ void MDL_lock::remove_ticket(LF_PINS *pins, Ticket_list MDL_lock::*list,
       pending request).
     */
     reschedule_waiters();
+    unblock_fast_path();
     mysql_prlock_unlock(&m_rwlock);
   }
 }
 
 
+/**
+  Grant unobtrusive lock by adding the ticket to the fast path shard
+  of its context.
+
+  @retval TRUE   Lock was granted.
+  @retval FALSE  The shard is blocked, slow path must be used.
+*/
+
+bool MDL_lock::add_fast_path_ticket(MDL_ticket *ticket)
+{
+  Fast_path_shard *shard= &m_fast_path[ticket->m_fast_path_shard];
+
+  DBUG_ASSERT(MDL_BIT(ticket->get_type()) &
+              get_strategy(&key)->fast_path_types_bitmap());
+
+  mysql_mutex_lock(&shard->LOCK_fast_path);
+  if (shard->m_blocked)
+  {
+    mysql_mutex_unlock(&shard->LOCK_fast_path);
+    return false;
+  }
+  ticket->m_lock= this;
+  ticket->m_is_fast_path= true;
+  shard->m_tickets.add_ticket(ticket);
+  shard->m_n_tickets.store(shard->m_n_tickets.load(std::memory_order_relaxed)
+                           + 1, std::memory_order_relaxed);
+  mysql_mutex_unlock(&shard->LOCK_fast_path);
+  return true;
+}
+
+
+/**
+  Release lock granted through the fast path.
+
+  If this left all shards empty, the lock may have become unused, and
+  it is removed from MDL_map as MDL_lock::remove_ticket() would do it.
+  Otherwise m_rwlock is not acquired.
+
+  @retval TRUE   The ticket was removed.
+  @retval FALSE  The ticket was moved to m_granted by block_fast_path()
+                 and must be released through the slow path.
+*/
+
+bool MDL_lock::remove_fast_path_ticket(LF_PINS *pins, MDL_ticket *ticket)
+{
+  Fast_path_shard *shard= &m_fast_path[ticket->m_fast_path_shard];
+
+  mysql_mutex_lock(&shard->LOCK_fast_path);
+  if (!ticket->m_is_fast_path)
+  {
+    mysql_mutex_unlock(&shard->LOCK_fast_path);
+    return false;
+  }
+  shard->m_tickets.remove_ticket(ticket);
+  ticket->m_is_fast_path= false;
+  uint32_t n_tickets= shard->m_n_tickets.load(std::memory_order_relaxed);
+  DBUG_ASSERT(n_tickets);
+  if (!--n_tickets)
+  {
+    /*
+      Once the shard is empty, the object may be removed from MDL_map
+      and reused by other threads. Pin it to be able to check it after
+      the mutex is released.
+    */
+    lf_pin(pins, 2, this);
+  }
+  shard->m_n_tickets.store(n_tickets);
+  mysql_mutex_unlock(&shard->LOCK_fast_path);
+
+  if (n_tickets)
+    return true;
+
+  /*
+    Only a release that finds all shards empty checks if the lock became
+    unused. Each release stores the count of its own shard before it
+    reads the others, so of two releases that empty different shards at
+    the same time at least one sees all of them empty. close_fast_path()
+    rechecks the shards under their mutexes.
+
+    If the fast path is blocked, an obtrusive ticket exists and will
+    remove the lock when it is released. Shards are blocked only after
+    their tickets are moved to m_granted, so there can be no waiters to
+    reschedule either.
+  */
+  for (uint i= 0; i < MDL_FAST_PATH_SHARDS && !n_tickets; i++)
+    n_tickets= m_fast_path[i].m_n_tickets.load();
+
+  if (!n_tickets)
+  {
+    mysql_prlock_wrlock(&m_rwlock);
+    if (m_strategy && is_empty() && close_fast_path())
+    {
+      mdl_locks.remove(pins, this);
+      return true;
+    }
+    mysql_prlock_unlock(&m_rwlock);
+  }
+  lf_hash_search_unpin(pins);
+  return true;
+}
+
+
+/**
+  Move ticket granted through the fast path to m_granted.
+
+  @pre m_rwlock is write-locked.
+*/
+
+void MDL_lock::materialize_fast_path_ticket(MDL_ticket *ticket)
+{
+  Fast_path_shard *shard= &m_fast_path[ticket->m_fast_path_shard];
+
+  mysql_mutex_lock(&shard->LOCK_fast_path);
+  if (ticket->m_is_fast_path)
+  {
+    shard->m_tickets.remove_ticket(ticket);
+    ticket->m_is_fast_path= false;
+    shard->m_n_tickets.store(shard->m_n_tickets.load(std::memory_order_relaxed)
+                             - 1, std::memory_order_relaxed);
+    m_granted.add_ticket(ticket);
+  }
+  mysql_mutex_unlock(&shard->LOCK_fast_path);
+}
+
+
+/**
+  Stop granting locks through the fast path, and move all tickets
+  granted through it to m_granted. Called before obtrusive lock
+  request is checked against granted locks.
+
+  @pre m_rwlock is write-locked.
+*/
+
+void MDL_lock::block_fast_path()
+{
+  if (m_fast_path_blocked)
+    return;
+  m_fast_path_blocked= true;
+
+  for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+  {
+    Fast_path_shard *shard= &m_fast_path[i];
+    MDL_ticket *ticket;
+
+    mysql_mutex_lock(&shard->LOCK_fast_path);
+    shard->m_blocked= true;
+    Ticket_iterator it(shard->m_tickets);
+    while ((ticket= it++))
+    {
+      shard->m_tickets.remove_ticket(ticket);
+      ticket->m_is_fast_path= false;
+      m_granted.add_ticket(ticket);
+    }
+    shard->m_n_tickets.store(0, std::memory_order_relaxed);
+    mysql_mutex_unlock(&shard->LOCK_fast_path);
+  }
+}
+
+
+/**
+  Reopen fast path if there are no obtrusive locks granted or pending.
+
+  @pre m_rwlock is write-locked.
+*/
+
+void MDL_lock::unblock_fast_path()
+{
+  if (!m_fast_path_blocked ||
+      ((m_granted.bitmap() | m_waiting.bitmap()) & ~fast_path_types_bitmap()))
+    return;
+  m_fast_path_blocked= false;
+
+  for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+  {
+    mysql_mutex_lock(&m_fast_path[i].LOCK_fast_path);
+    m_fast_path[i].m_blocked= false;
+    mysql_mutex_unlock(&m_fast_path[i].LOCK_fast_path);
+  }
+}
+
+
+/**
+  Close the fast path if there are no tickets in shards, so that the lock
+  can be removed from MDL_map.
+
+  @pre m_rwlock is write-locked and is_empty() is TRUE.
+
+  @retval TRUE   Shards are closed, the lock is unused.
+  @retval FALSE  Some shard has tickets.
+*/
+
+bool MDL_lock::close_fast_path()
+{
+  bool res= true;
+  DBUG_ASSERT(is_empty());
+
+  /*
+    Blocked shards are empty, their tickets were moved to m_granted.
+    Namespaces without unobtrusive lock types never use the shards.
+  */
+  if (m_fast_path_blocked || !fast_path_types_bitmap())
+    return true;
+
+  for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+  {
+    mysql_mutex_lock(&m_fast_path[i].LOCK_fast_path);
+    if (m_fast_path[i].m_n_tickets.load(std::memory_order_relaxed))
+      res= false;
+  }
+  if (res)
+  {
+    m_fast_path_blocked= true;
+    for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+      m_fast_path[i].m_blocked= true;
+  }
+  for (uint i= 0; i < MDL_FAST_PATH_SHARDS; i++)
+    mysql_mutex_unlock(&m_fast_path[i].LOCK_fast_path);
+  return res;
+}
+
+
 /**
   Check if we have any pending locks which conflict with existing
   shared lock.
@@ -2004,6 +2414,7 @@ MDL_context::try_acquire_lock(MDL_request *mdl_request)
       is no need to release it.
     */
     DBUG_ASSERT(! ticket->m_lock->is_empty());
+    ticket->m_lock->unblock_fast_path();
     mysql_prlock_unlock(&ticket->m_lock->m_rwlock);
     MDL_ticket::destroy(ticket);
   }
@@ -2036,6 +2447,7 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
   MDL_key *key= &mdl_request->key;
   MDL_ticket *ticket;
   enum_mdl_duration found_duration;
+  MDL_lock::bitmap_t fast_path_types;
 
   /* Don't take chances in production. */
   DBUG_ASSERT(mdl_request->ticket == NULL);
@@ -2088,6 +2500,18 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
                                    )))
     return TRUE;
 
+  fast_path_types= MDL_lock::get_strategy(key)->fast_path_types_bitmap();
+  if (MDL_BIT(mdl_request->type) & fast_path_types)
+  {
+    ticket->m_fast_path_shard= get_thread_id() % MDL_FAST_PATH_SHARDS;
+    if (mdl_locks.add_fast_path_ticket(m_pins, key, ticket))
+    {
+      m_tickets[mdl_request->duration].push_front(ticket);
+      mdl_request->ticket= ticket;
+      return FALSE;
+    }
+  }
+
   /* The below call implicitly locks MDL_lock::m_rwlock on success. */
   if (!(lock= mdl_locks.find_or_insert(m_pins, key)))
   {
@@ -2097,6 +2521,13 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
 
   ticket->m_lock= lock;
 
+  /*
+    Obtrusive lock must see all granted locks, including those granted
+    through the fast path.
+  */
+  if (fast_path_types && !(MDL_BIT(mdl_request->type) & fast_path_types))
+    lock->block_fast_path();
+
   if (lock->can_grant_lock(mdl_request->type, this, false))
   {
     lock->m_granted.add_ticket(ticket);
@@ -2268,6 +2699,7 @@ MDL_context::acquire_lock(MDL_request *mdl_request, double lock_wait_timeout)
 
   if (lock_wait_timeout == 0)
   {
+    lock->unblock_fast_path();
     mysql_prlock_unlock(&lock->m_rwlock);
     MDL_ticket::destroy(ticket);
     my_error(ER_LOCK_WAIT_TIMEOUT, MYF(0));
@@ -2527,8 +2959,13 @@ MDL_context::upgrade_shared_lock(MDL_ticket *mdl_ticket,
 
   /* Merge the acquired and the original lock. @todo: move to a method. */
   mysql_prlock_wrlock(&mdl_ticket->m_lock->m_rwlock);
+  /* Upgraded ticket is always kept in m_granted. */
+  mdl_ticket->m_lock->materialize_fast_path_ticket(mdl_ticket);
   if (is_new_ticket)
+  {
+    mdl_ticket->m_lock->materialize_fast_path_ticket(mdl_xlock_request.ticket);
     mdl_ticket->m_lock->m_granted.remove_ticket(mdl_xlock_request.ticket);
+  }
   /*
     Set the new type of lock in the ticket. To update state of
     MDL_lock object correctly we need to temporarily exclude
@@ -2814,7 +3251,9 @@ void MDL_context::release_lock(enum_mdl_duration duration, MDL_ticket *ticket)
 
   DBUG_ASSERT(this == ticket->get_ctx());
 
-  lock->remove_ticket(m_pins, &MDL_lock::m_granted, ticket);
+  if (!(MDL_BIT(ticket->m_type) & lock->fast_path_types_bitmap()) ||
+      !lock->remove_fast_path_ticket(m_pins, ticket))
+    lock->remove_ticket(m_pins, &MDL_lock::m_granted, ticket);
 
   m_tickets[duration].remove(ticket);
   MDL_ticket::destroy(ticket);
@@ -2932,6 +3371,7 @@ void MDL_ticket::downgrade_lock(enum_mdl_type type)
   m_type= type;
   m_lock->m_granted.add_ticket(this);
   m_lock->reschedule_waiters();
+  m_lock->unblock_fast_path();
   mysql_prlock_unlock(&m_lock->m_rwlock);
 }
 
@@ -720,6 +720,7 @@ class MDL_ticket : public MDL_wait_for_subgraph
   virtual uint get_deadlock_weight() const;
 private:
   friend class MDL_context;
+  friend class MDL_lock;
 
   MDL_ticket(MDL_context *ctx_arg, enum_mdl_type type_arg
 #ifndef DBUG_OFF
@@ -731,7 +732,9 @@ class MDL_ticket : public MDL_wait_for_subgraph
      m_duration(duration_arg),
 #endif
      m_ctx(ctx_arg),
-     m_lock(NULL)
+     m_lock(NULL),
+     m_fast_path_shard(0),
+     m_is_fast_path(false)
   {}
 
   static MDL_ticket *create(MDL_context *ctx_arg, enum_mdl_type type_arg
@@ -760,6 +763,19 @@ class MDL_ticket : public MDL_wait_for_subgraph
   */
   MDL_lock *m_lock;
 
+  /**
+    Index of the MDL_lock fast path shard used by this ticket.
+    Context private.
+  */
+  uint m_fast_path_shard;
+
+  /**
+    TRUE if the ticket is in a fast path shard rather than in the list of
+    granted tickets. Externally accessible, protected by the mutex of
+    the shard.
+  */
+  bool m_is_fast_path;
+
 private:
   MDL_ticket(const MDL_ticket &);               /* not implemented */
   MDL_ticket &operator=(const MDL_ticket &);    /* not implemented */
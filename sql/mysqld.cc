@@ -112,6 +112,7 @@
 #include <errmsg.h>
 #include "sp_rcontext.h"
 #include "sp_cache.h"
+#include "filesort_utils.h"                    // init_sort_threads
 #include "sql_reload.h"  // reload_acl_and_cache
 #include "pcre.h"
 
@@ -1089,7 +1090,8 @@ static PSI_cond_info all_server_conds[]=
 PSI_thread_key key_thread_delayed_insert,
   key_thread_handle_manager, key_thread_main,
   key_thread_one_connection, key_thread_signal_hand,
-  key_thread_slave_background, key_rpl_parallel_thread;
+  key_thread_slave_background, key_rpl_parallel_thread,
+  key_thread_sort_worker;
 PSI_thread_key key_thread_ack_receiver;
 
 static PSI_thread_info all_server_threads[]=
@@ -1101,7 +1103,8 @@ static PSI_thread_info all_server_threads[]=
   { &key_thread_signal_hand, "signal_handler", PSI_FLAG_GLOBAL},
   { &key_thread_slave_background, "slave_background", PSI_FLAG_GLOBAL},
   { &key_thread_ack_receiver, "Ack_receiver", PSI_FLAG_GLOBAL},
-  { &key_rpl_parallel_thread, "rpl_parallel_thread", 0}
+  { &key_rpl_parallel_thread, "rpl_parallel_thread", 0},
+  { &key_thread_sort_worker, "sort_worker", 0}
 };
 
 #ifdef HAVE_MMAP
@@ -1991,6 +1994,7 @@ static void clean_up(bool print_message)
   wt_end();
   multi_keycache_free();
   sp_cache_end();
+  end_sort_threads();
   free_status_vars();
   end_thr_alarm(1);			/* Free allocated memory */
 #ifndef EMBEDDED_LIBRARY
@@ -4329,6 +4333,7 @@ static int init_thread_environment()
   server_threads.init();
   mysql_mutex_init(key_LOCK_thread_cache, &LOCK_thread_cache, MY_MUTEX_INIT_FAST);
   mysql_mutex_init(key_LOCK_start_thread, &LOCK_start_thread, MY_MUTEX_INIT_FAST);
+  init_sort_threads();
   mysql_mutex_init(key_LOCK_status, &LOCK_status, MY_MUTEX_INIT_FAST);
   mysql_mutex_init(key_LOCK_delayed_insert,
                    &LOCK_delayed_insert, MY_MUTEX_INIT_FAST);
@@ -7032,6 +7037,16 @@ static int show_open_tables(THD *thd, SHOW_VAR *var, char *buff,
   return 0;
 }
 
+static int show_table_cache_instances(THD *thd, SHOW_VAR *var, char *buff,
+                                      enum enum_var_type scope)
+{
+  DBUG_ASSERT((tc_instances + 1) * sizeof(SHOW_VAR) <= SHOW_VAR_FUNC_BUFF_SIZE);
+  var->type= SHOW_ARRAY;
+  var->value= buff;
+  tc_status_vars((SHOW_VAR *) buff);
+  return 0;
+}
+
 static int show_prepared_stmt_count(THD *thd, SHOW_VAR *var, char *buff,
                                     enum enum_var_type scope)
 {
@@ -7532,6 +7547,7 @@ SHOW_VAR status_vars[]= {
   {"Select_full_range_join",   (char*) offsetof(STATUS_VAR, select_full_range_join_count_), SHOW_LONG_STATUS},
   {"Select_range",             (char*) offsetof(STATUS_VAR, select_range_count_), SHOW_LONG_STATUS},
   {"Select_range_check",       (char*) offsetof(STATUS_VAR, select_range_check_count_), SHOW_LONG_STATUS},
+  {"Select_reused_join_order", (char*) offsetof(STATUS_VAR, select_reused_join_order), SHOW_LONG_STATUS},
   {"Select_scan",	       (char*) offsetof(STATUS_VAR, select_scan_count_), SHOW_LONG_STATUS},
   {"Slave_open_temp_tables",   (char*) &slave_open_temp_tables, SHOW_INT},
 #ifdef HAVE_REPLICATION
@@ -7591,6 +7607,7 @@ SHOW_VAR status_vars[]= {
   {"Table_locks_waited",       (char*) &locks_waited,           SHOW_LONG},
   {"Table_open_cache_active_instances", (char*) &tc_active_instances, SHOW_UINT},
   {"Table_open_cache_hits",    (char*) offsetof(STATUS_VAR, table_open_cache_hits), SHOW_LONGLONG_STATUS},
+  {"Table_open_cache_instance", (char*) &show_table_cache_instances, SHOW_SIMPLE_FUNC},
   {"Table_open_cache_misses",  (char*) offsetof(STATUS_VAR, table_open_cache_misses), SHOW_LONGLONG_STATUS},
   {"Table_open_cache_overflows", (char*) offsetof(STATUS_VAR, table_open_cache_overflows), SHOW_LONGLONG_STATUS},
 #ifdef HAVE_MMAP
@@ -9096,6 +9113,7 @@ void refresh_status(THD *thd)
 
   /* Reset the counters of all key caches (default and named). */
   process_key_caches(reset_key_cache_counters, 0);
+  tc_reset_status();
   flush_status_time= time((time_t*) 0);
   mysql_mutex_unlock(&LOCK_status);
 
@@ -78,5 +78,13 @@ void Filesort_tracker::print_json_members(Json_writer *writer)
     else
       writer->add_size(sort_buffer_size);
   }
+
+  if (r_parallel_sorts)
+  {
+    writer->add_member("r_parallel_sorts").add_ll(
+                        (longlong) rint((double)r_parallel_sorts /
+                                        get_r_loops()));
+    writer->add_member("r_sort_threads").add_ll(r_sort_threads);
+  }
 }
 
@@ -181,7 +181,7 @@ class Filesort_tracker : public Sql_alloc
     time_tracker(do_timing), r_limit(0), r_used_pq(0),
     r_examined_rows(0), r_sorted_rows(0), r_output_rows(0),
     sort_passes(0),
-    sort_buffer_size(0)
+    sort_buffer_size(0), r_parallel_sorts(0), r_sort_threads(0)
   {}
   
   /* Functions that filesort uses to report various things about its execution */
@@ -223,6 +223,12 @@ class Filesort_tracker : public Sql_alloc
     else
       sort_buffer_size= bufsize;
   }
+
+  inline void report_parallel_sorts(ulong sorts, uint threads)
+  {
+    r_parallel_sorts+= sorts;
+    set_if_bigger(r_sort_threads, threads);
+  }
   
   /* Functions to get the statistics */
   void print_json_members(Json_writer *writer);
@@ -282,6 +288,12 @@ class Filesort_tracker : public Sql_alloc
     other          - value
   */
   ulonglong sort_buffer_size;
+
+  /* How many sort buffers were sorted by multiple threads */
+  ulonglong r_parallel_sorts;
+
+  /* Max number of threads that sorted one sort buffer */
+  uint r_sort_threads;
 };
 
 
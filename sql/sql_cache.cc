@@ -640,16 +640,21 @@ bool Query_cache::try_lock(THD *thd, Cache_try_lock_mode mode)
       */
       if (mode == WAIT)
       {
+        lock_waits++;
         mysql_cond_wait(&COND_cache_status_changed, &structure_guard_mutex);
       }
       else if (mode == TIMEOUT)
       {
         struct timespec waittime;
         set_timespec_nsec(waittime,50000000UL);  /* Wait for 50 msec */
+        lock_waits++;
         int res= mysql_cond_timedwait(&COND_cache_status_changed,
                                       &structure_guard_mutex, &waittime);
         if (res == ETIMEDOUT)
+        {
+          lock_timeouts++;
           break;
+        }
       }
       else
       {
@@ -722,8 +727,13 @@ void Query_cache::lock(THD *thd)
   mysql_mutex_lock(&structure_guard_mutex);
   m_requests_in_progress++;
   fix_local_query_cache_mode(thd);
-  while (m_cache_lock_status != Query_cache::UNLOCKED)
-    mysql_cond_wait(&COND_cache_status_changed, &structure_guard_mutex);
+  if (m_cache_lock_status != Query_cache::UNLOCKED)
+  {
+    lock_waits++;
+    do
+      mysql_cond_wait(&COND_cache_status_changed, &structure_guard_mutex);
+    while (m_cache_lock_status != Query_cache::UNLOCKED);
+  }
   m_cache_lock_status= Query_cache::LOCKED;
 #ifndef DBUG_OFF
   m_cache_lock_thread_id= thd->thread_id;
@@ -1275,6 +1285,7 @@ Query_cache::Query_cache(size_t query_cache_limit_arg,
    query_cache_limit(query_cache_limit_arg),
    queries_in_cache(0), hits(0), inserts(0), refused(0),
    total_blocks(0), lowmem_prunes(0),
+   misses(0), lock_waits(0), lock_timeouts(0),
    m_cache_status(OK),
    min_allocation_unit(ALIGN_SIZE(min_allocation_unit_arg)),
    min_result_data_size(ALIGN_SIZE(min_result_data_size_arg)),
@@ -1288,6 +1299,8 @@ Query_cache::Query_cache(size_t query_cache_limit_arg,
   set_if_bigger(min_allocation_unit,min_needed);
   this->min_allocation_unit= ALIGN_SIZE(min_allocation_unit);
   set_if_bigger(this->min_result_data_size,min_allocation_unit);
+  for (uint i= 0; i < QUERY_CACHE_TABLE_FILTER_SIZE; i++)
+    m_table_filter[i]= 0;
 }
 
 
@@ -1869,23 +1882,8 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
       goto err;
     }
   }
-  /*
-    Try to obtain an exclusive lock on the query cache. If the cache is
-    disabled or if a full cache flush is in progress, the attempt to
-    get the lock is aborted.
-
-    The TIMEOUT parameter indicate that the lock is allowed to timeout.
-  */
-  if (try_lock(thd, Query_cache::TIMEOUT))
-    goto err;
-
-  if (query_cache_size == 0)
-  {
-    thd->query_cache_is_applicable= 0;            // Query can't be cached
-    goto err_unlock;
-  }
-
   Query_cache_block *query_block;
+  my_hash_value_type hash_value;
   if (thd->variables.query_cache_strip_comments)
   {
     if (found_brace)
@@ -1972,20 +1970,45 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
   memcpy((uchar *)(sql + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
 	 (uchar*) &flags, QUERY_CACHE_FLAGS_SIZE);
 
+  /*
+    The key of the query and its hash value only depend on this
+    connection, so they are computed before locking the cache, to keep
+    the time that the lock is held during the lookup short.
+  */
+  hash_value= my_hash_sort(&my_charset_bin, (uchar*) sql, tot_length);
+
+  /*
+    Try to obtain an exclusive lock on the query cache. If the cache is
+    disabled or if a full cache flush is in progress, the attempt to
+    get the lock is aborted.
+
+    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+  */
+  if (try_lock(thd, Query_cache::TIMEOUT))
+    goto err;
+
+  if (query_cache_size == 0)
+  {
+    thd->query_cache_is_applicable= 0;            // Query can't be cached
+    goto err_unlock;
+  }
+
 #ifdef WITH_WSREP
   bool once_more;
   once_more= true;
 lookup:
 #endif /* WITH_WSREP */
 
-  query_block = (Query_cache_block *)  my_hash_search(&queries, (uchar*) sql,
-                                                      tot_length);
+  query_block = (Query_cache_block *)
+    my_hash_search_using_hash_value(&queries, hash_value,
+                                    (uchar*) sql, tot_length);
   /* Quick abort on unlocked data */
   if (query_block == 0 ||
       query_block->query()->result() == 0 ||
       query_block->query()->result()->type != Query_cache_block::RESULT)
   {
     DBUG_PRINT("qcache", ("No query in query hash or no results"));
+    misses++;
     goto err_unlock;
   }
   DBUG_PRINT("qcache", ("Query in query hash %p",query_block));
@@ -2835,6 +2858,8 @@ void Query_cache::free_cache()
   make_disabled();
   my_hash_free(&queries);
   my_hash_free(&tables);
+  for (uint i= 0; i < QUERY_CACHE_TABLE_FILTER_SIZE; i++)
+    m_table_filter[i]= 0;
   DBUG_VOID_RETURN;
 }
 
@@ -3302,6 +3327,19 @@ void Query_cache::invalidate_table(THD *thd, TABLE *table)
 
 void Query_cache::invalidate_table(THD *thd, uchar * key, size_t key_length)
 {
+  /*
+    If no cached query uses a table whose key maps to the same slot,
+    there is nothing to invalidate, and the lock can be skipped.
+
+    The fence orders the preceding modification of the table before
+    the read of the filter. insert_table() orders the increment of the
+    filter before the query reads the table in the same way, so either
+    we see the increment, or the query sees the modification.
+  */
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!m_table_filter[table_filter_slot(key, key_length)])
+    return;
+
   DEBUG_SYNC(thd, "wait_in_query_cache_invalidate1");
 
   /*
@@ -3319,6 +3357,25 @@ void Query_cache::invalidate_table(THD *thd, uchar * key, size_t key_length)
 }
 
 
+/**
+  Map a table key to a slot of m_table_filter.
+  Keys that the tables hash considers equal must map to the same slot,
+  so the collation of the hash (see init_cache()) is used.
+*/
+
+uint Query_cache::table_filter_slot(const uchar *key, size_t key_length)
+{
+#ifndef FN_NO_CASE_SENSE
+  CHARSET_INFO *cs= &my_charset_bin;
+#else
+  CHARSET_INFO *cs= lower_case_table_names ? &my_charset_bin :
+                    files_charset_info;
+#endif
+  return my_hash_sort(cs, key, key_length) &
+         (QUERY_CACHE_TABLE_FILTER_SIZE - 1);
+}
+
+
 /**
   Try to locate and invalidate a table by name.
   The caller must ensure that no other thread is trying to work with
@@ -3566,6 +3623,12 @@ Query_cache::insert_table(THD *thd, size_t key_len, const char *key,
       free_memory_block(table_block);
       DBUG_RETURN(0);
     }
+    if (hash)
+    {
+      m_table_filter[table_filter_slot((const uchar*) key, key_len)]++;
+      /* See invalidate_table() */
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
     char *db= header->db();
     header->table(db + db_length + 1);
     header->key_length((uint32)key_len);
@@ -3629,7 +3692,11 @@ void Query_cache::unlink_table(Query_cache_block_table *node)
                                &tables_blocks);
     Query_cache_table *header= table_block->table();
     if (header->is_hashed())
+    {
+      m_table_filter[table_filter_slot((const uchar*) header->db(),
+                                       header->key_length())]--;
       my_hash_delete(&tables,(uchar *) table_block);
+    }
     free_memory_block(table_block);
   }
   DBUG_VOID_RETURN;
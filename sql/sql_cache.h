@@ -18,6 +18,7 @@
 
 #include "hash.h"
 #include "my_base.h"                            /* ha_rows */
+#include "my_counter.h"                         /* Atomic_counter */
 
 class MY_LOCALE;
 struct TABLE_LIST;
@@ -40,6 +41,12 @@ typedef struct st_changed_table_list CHANGED_TABLE_LIST;
 #define QUERY_CACHE_DEF_QUERY_HASH_SIZE		1024
 #define QUERY_CACHE_DEF_TABLE_HASH_SIZE		1024
 
+/*
+  number of slots in the filter that lets invalidation skip the lock
+  for tables that no cached query uses (power of 2)
+*/
+#define QUERY_CACHE_TABLE_FILTER_SIZE		4096
+
 /* minimal result data size when data allocated */
 #define QUERY_CACHE_MIN_RESULT_DATA_SIZE	(1024*4)
 
@@ -305,6 +312,8 @@ class Query_cache
   /* statistics */
   size_t free_memory, queries_in_cache, hits, inserts, refused,
     free_memory_blocks, total_blocks, lowmem_prunes;
+  /* lookups that found no result, waits for the lock, lock timeouts */
+  size_t misses, lock_waits, lock_timeouts;
 
 
 private:
@@ -318,6 +327,13 @@ class Query_cache
   enum Cache_staus {OK, DISABLE_REQUEST, DISABLED};
   Cache_staus m_cache_status;
 
+  /*
+    Number of hashed table blocks whose key maps to each slot; see
+    table_filter_slot(). Updated under the cache lock, read without it.
+  */
+  Atomic_counter<uint32> m_table_filter[QUERY_CACHE_TABLE_FILTER_SIZE];
+
+  static uint table_filter_slot(const uchar *key, size_t key_length);
   void free_query_internal(Query_cache_block *point);
   void invalidate_table_internal(THD *thd, uchar *key, size_t key_length);
 
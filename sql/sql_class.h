@@ -635,6 +635,7 @@ typedef struct system_variables
   ulong max_length_for_sort_data;
   ulong max_recursive_iterations;
   ulong max_sort_length;
+  uint max_sort_threads;
   ulong max_tmp_tables;
   ulong max_insert_delayed_threads;
   ulong min_examined_row_limit;
@@ -768,6 +769,7 @@ typedef struct system_variables
   my_bool session_track_state_change;
   my_bool session_track_user_variables;
   my_bool tcp_nodelay;
+  my_bool optimizer_reuse_join_order;
 
   ulong threadpool_priority;
 
@@ -777,6 +779,7 @@ typedef struct system_variables
   uint column_compression_threshold;
   uint column_compression_zlib_level;
   uint in_subquery_conversion_threshold;
+  uint hash_join_max_partitions;
   ulonglong max_rowid_filter_size;
 
   vers_asof_timestamp_t vers_asof_timestamp;
@@ -855,6 +858,7 @@ typedef struct system_status_var
   ulong select_range_count_;
   ulong select_range_check_count_;
   ulong select_scan_count_;
+  ulong select_reused_join_order;   /* +1 when a saved join order is used */
   ulong update_scan_count;
   ulong delete_scan_count;
   ulong executed_triggers;
@@ -6225,6 +6229,12 @@ struct SORT_FIELD_ATTR
 {
   uint length;          /* Length of sort field */
   uint suffix_length;   /* Length suffix (0-4) */
+  /*
+    Length prefix (1-4) if the value is stored packed, that is only its
+    actual bytes are stored instead of padding it up to 'length'.
+    0 for fixed length key parts.
+  */
+  uint length_bytes;
 };
 
 
@@ -6233,6 +6243,8 @@ struct SORT_FIELD: public SORT_FIELD_ATTR
   Field *field;				/* Field to sort */
   Item	*item;				/* Item if not sorting fields */
   bool reverse;				/* if descending sort */
+  bool maybe_null;                      /* if key part has a NULL marker */
+  CHARSET_INFO *cs;                     /* To compare packed values */
 };
 
 
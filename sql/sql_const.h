@@ -98,6 +98,9 @@
 
 #define MAX_SORT_MEMORY 2048*1024
 #define MIN_SORT_MEMORY 1024
+#define MAX_SORT_THREADS 64
+/* A sort buffer is not split into slices smaller than this */
+#define MIN_KEYS_PER_SORT_THREAD 4096
 
 /* Some portable defines */
 
@@ -240,6 +243,13 @@
 */
 #define MATCHING_ROWS_IN_OTHER_TABLE 10
 
+/**
+  A join order that was saved by choose_plan() for a prepared statement or
+  stored routine is reused only while the estimated number of rows of the
+  join stays within this factor of the estimate it was chosen for.
+*/
+#define JOIN_ORDER_REUSE_MAX_ROWS_RATIO 10.0
+
 /*
   Subquery materialization-related constants
 */
@@ -3131,8 +3131,7 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
     the calculated index of the hash entry for the given key  
 */
 
-inline
-uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
+static inline ulong get_simple_hash_value(uchar *key, uint key_len)
 {
   ulong nr= 1;
   ulong nr2= 4;
@@ -3143,7 +3142,13 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
     nr^= (ulong) ((((uint) nr & 63)+nr2)*((uint) *pos))+ (nr << 8);
     nr2+= 3;
   }
-  return nr % hash_entries;
+  return nr;
+}
+
+inline
+uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
+{
+  return get_simple_hash_value(key, key_len) % hash_entries;
 }
 
 
@@ -3178,6 +3183,30 @@ uint JOIN_CACHE_HASHED::get_hash_idx_complex(uchar *key, uint key_len)
 }
 
 
+/*
+  Get the hash value of a key
+
+  SYNOPSIS
+    get_hash_value()
+      key             pointer to the key value
+
+  DESCRIPTION
+    The function returns the value that the hash function of the cache
+    takes modulo the number of hash entries. Equal keys always get equal
+    hash values.
+
+  RETURN VALUE
+    the hash value for the given key
+*/
+
+ulong JOIN_CACHE_HASHED::get_hash_value(uchar *key)
+{
+  if (hash_func == &JOIN_CACHE_HASHED::get_hash_idx_complex)
+    return key_hashnr(ref_key_info, ref_used_key_parts, key);
+  return get_simple_hash_value(key, key_length);
+}
+
+
 /* 
   Compare two key entries in the hash table as sequence of bytes
 
@@ -3813,6 +3842,443 @@ int JOIN_CACHE_BNLH::init(bool for_explain)
 }
 
 
+/*
+  Check whether the join buffer of the BNLH cache can be spilled to disk
+
+  SYNOPSIS
+    can_spill()
+
+  DESCRIPTION
+    The function checks whether the records from the join buffer and the
+    records of join_tab can be partitioned by the hash values of their
+    join keys and written into temporary files as plain record images.
+    This is possible if the variable hash_join_max_partitions allows it,
+    the cache is not linked to other caches, the operation is an inner join
+    (no match flags are needed), and neither the tables whose rows are
+    stored in the join buffer nor join_tab have blobs or need row ids.
+
+  RETURN VALUE
+    TRUE    the join buffer can be spilled
+    FALSE   otherwise
+*/
+
+bool JOIN_CACHE_BNLH::can_spill()
+{
+  if (join->thd->variables.hash_join_max_partitions < 2 ||
+      get_join_alg() != BNLH_JOIN_ALG ||
+      prev_cache || next_cache || with_match_flag ||
+      join_tab->first_inner || join_tab->bush_root_tab ||
+      join_tab->keep_current_rowid || join_tab->use_quick == 2 ||
+      join_tab->table->s->blob_fields)
+    return FALSE;
+
+  for (JOIN_TAB *tab= start_tab; tab != join_tab;
+       tab= next_linear_tab(join, tab, WITHOUT_BUSH_ROOTS))
+  {
+    if (tab->keep_current_rowid || tab->table->s->blob_fields)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+
+/*
+  Start spilling the records of the BNLH join cache to disk
+
+  SYNOPSIS
+    start_spill()
+
+  DESCRIPTION
+    The function is called when the join buffer becomes full for the first
+    time. It chooses the number of partitions from the estimated number of
+    partial join records, opens the partition files and moves all records
+    from the join buffer into the partitions of the outer records. After
+    this put_record() writes all the following records directly to the
+    partition files, and the join itself is performed by join_records()
+    partition by partition when all records have been received.
+
+  RETURN VALUE
+    FALSE   the join buffer has been spilled
+    TRUE    the join buffer could not be spilled, or an error occurred that
+            is reported by join_records() through spill_error
+*/
+
+bool JOIN_CACHE_BNLH::start_spill()
+{
+  JOIN_TAB *tab;
+  uint max_partitions= join->thd->variables.hash_join_max_partitions;
+  double outer_rows= (join_tab-1)->get_partial_join_cardinality();
+  DBUG_ENTER("JOIN_CACHE_BNLH::start_spill");
+
+  /*
+    Aim at partitions that are half as large as the join buffer to allow
+    for errors in the estimate and for skew.
+  */
+  partitions= 2;
+  if (outer_rows > (double) records)
+    partitions= (uint) MY_MIN(2.0 * outer_rows / records + 1,
+                              (double) max_partitions);
+  set_if_bigger(partitions, 2);
+
+  outer_row_length= 0;
+  for (tab= start_tab; tab != join_tab;
+       tab= next_linear_tab(join, tab, WITHOUT_BUSH_ROOTS))
+    outer_row_length+= 1 + tab->table->s->reclength;
+
+  spill_error= FALSE;
+  if (!my_multi_malloc(MYF(MY_THREAD_SPECIFIC),
+                       &outer_parts, partitions * sizeof(IO_CACHE),
+                       &inner_parts, partitions * sizeof(IO_CACHE),
+                       &outer_row, outer_row_length,
+                       NullS))
+  {
+    /* Just go on with the join buffer as it is */
+    partitions= 0;
+    DBUG_RETURN(TRUE);
+  }
+  for (uint i= 0; i < partitions; i++)
+  {
+    my_b_clear(outer_parts + i);
+    my_b_clear(inner_parts + i);
+  }
+  for (uint i= 0; i < partitions; i++)
+  {
+    if (open_cached_file(outer_parts + i, mysql_tmpdir, TEMP_PREFIX,
+                         IO_SIZE * 4, MYF(MY_WME)) ||
+        open_cached_file(inner_parts + i, mysql_tmpdir, TEMP_PREFIX,
+                         IO_SIZE * 4, MYF(MY_WME)))
+    {
+      spill_error= TRUE;
+      DBUG_RETURN(TRUE);
+    }
+  }
+  DBUG_PRINT("info", ("spilling %lu records into %u partitions",
+                      (ulong) records, partitions));
+
+  /* Move the records from the join buffer into the partitions */
+  reset(FALSE);
+  for (size_t i= 0; i < records && !spill_error; i++)
+  {
+    get_record();
+    spill_error= write_outer_row();
+  }
+  /* The last record is the current partial join record */
+  restore_last_record();
+  reset(TRUE);
+  DBUG_RETURN(spill_error);
+}
+
+
+/*
+  Write the current partial join record into its outer partition
+
+  SYNOPSIS
+    write_outer_row()
+
+  DESCRIPTION
+    The function writes the images of the record buffers of all tables whose
+    fields are stored in the join buffer, each preceded by the null_row flag
+    of the table, into the outer partition chosen by the join key built
+    for the partial join record.
+
+  RETURN VALUE
+    FALSE   the record has been written
+    TRUE    otherwise
+*/
+
+bool JOIN_CACHE_BNLH::write_outer_row()
+{
+  TABLE_REF *ref= &join_tab->ref;
+  uchar *pos= outer_row;
+  for (JOIN_TAB *tab= start_tab; tab != join_tab;
+       tab= next_linear_tab(join, tab, WITHOUT_BUSH_ROOTS))
+  {
+    TABLE *table= tab->table;
+    *pos++= table->null_row;
+    memcpy(pos, table->record[0], table->s->reclength);
+    pos+= table->s->reclength;
+  }
+  cp_buffer_from_ref(join->thd, join_tab->table, ref);
+  return my_b_write(outer_parts + get_partition(ref->key_buff),
+                    outer_row, outer_row_length);
+}
+
+
+/*
+  Restore a partial join record written by write_outer_row()
+
+  SYNOPSIS
+    read_outer_row()
+
+  DESCRIPTION
+    The function copies the record images from outer_row back into
+    the record buffers of the tables whose fields are stored in the join
+    buffer.
+
+  RETURN VALUE
+    none
+*/
+
+void JOIN_CACHE_BNLH::read_outer_row()
+{
+  uchar *pos= outer_row;
+  for (JOIN_TAB *tab= start_tab; tab != join_tab;
+       tab= next_linear_tab(join, tab, WITHOUT_BUSH_ROOTS))
+  {
+    TABLE *table= tab->table;
+    table->null_row= *pos++;
+    memcpy(table->record[0], pos, table->s->reclength);
+    pos+= table->s->reclength;
+  }
+}
+
+
+/*
+  Add a record into the buffer of a BNLH join cache
+
+  SYNOPSIS
+    put_record()
+
+  DESCRIPTION
+    This implementation of the virtual function put_record calls the
+    implementation of the parent class until the join buffer becomes full
+    for the first time. If the join buffer can be spilled at this moment,
+    all buffered records and all records added after this are written into
+    the partition files instead, so the buffer never becomes full again.
+
+  RETURN VALUE
+    TRUE    if it has been decided that it should be the last record
+            in the join buffer,
+    FALSE   otherwise
+*/
+
+bool JOIN_CACHE_BNLH::put_record()
+{
+  if (partitions)
+  {
+    /* An error is reported by join_records() */
+    if (!spill_error)
+      spill_error= write_outer_row();
+    return spill_error;
+  }
+  if (!JOIN_CACHE_HASHED::put_record())
+    return FALSE;
+  return !can_spill() || start_spill();
+}
+
+
+/*
+  Join the records from an outer partition in the join buffer with join_tab
+
+  SYNOPSIS
+    join_partition_records()
+      inner_part    the inner partition with the same hash values
+
+  DESCRIPTION
+    The function reads the records of join_tab from the inner partition
+    into the record buffer of join_tab and probes the hash table of the
+    join buffer with the join key of each of them. For all matching records
+    from the join buffer the full extensions are generated as
+    join_matching_records() does.
+
+  RETURN VALUE
+    return one of enum_nested_loop_state
+*/
+
+enum_nested_loop_state
+JOIN_CACHE_BNLH::join_partition_records(IO_CACHE *inner_part)
+{
+  enum_nested_loop_state rc= NESTED_LOOP_OK;
+  TABLE *table= join_tab->table;
+  uchar *rec_ptr;
+
+  if (reinit_io_cache(inner_part, READ_CACHE, 0L, 0, 0))
+    return NESTED_LOOP_ERROR;
+
+  while (!my_b_read(inner_part, table->record[0], table->s->reclength))
+  {
+    if (unlikely(join->thd->check_killed()))
+      return NESTED_LOOP_KILLED;
+
+    table->status= 0;
+    if (prepare_look_for_matches(FALSE))
+      continue;
+    join_tab->jbuf_tracker->r_scans++;
+
+    while ((rec_ptr= get_next_candidate_for_match()))
+    {
+      join_tab->jbuf_tracker->r_rows++;
+      read_next_candidate_for_match(rec_ptr);
+      rc= generate_full_extensions(rec_ptr);
+      if (rc != NESTED_LOOP_OK && rc != NESTED_LOOP_NO_MORE_ROWS)
+        return rc;
+    }
+  }
+  return inner_part->error ? NESTED_LOOP_ERROR : rc;
+}
+
+
+/*
+  Perform the partitioned hash join for a spilled BNLH join cache
+
+  SYNOPSIS
+    join_partitions()
+
+  DESCRIPTION
+    The function reads all records of join_tab that satisfy the condition
+    pushed to it once and distributes them over the inner partitions by the
+    hash values of their join keys. Then for each partition it loads the
+    outer records of the partition into the join buffer and joins them with
+    the inner records of the same partition. If the outer records of a
+    partition do not fit into the join buffer, the inner partition is read
+    once for each refill of the buffer. The table join_tab is thus scanned
+    only once, however many times the join buffer is refilled.
+
+  RETURN VALUE
+    return one of enum_nested_loop_state
+*/
+
+enum_nested_loop_state JOIN_CACHE_BNLH::join_partitions()
+{
+  int error;
+  enum_nested_loop_state rc;
+  TABLE *table= join_tab->table;
+  KEY *keyinfo= join_tab->get_keyinfo_by_key_no(join_tab->ref.key);
+  DBUG_ENTER("JOIN_CACHE_BNLH::join_partitions");
+
+  table->null_row= 0;
+  if ((rc= join_tab_execution_startup(join_tab)) < 0)
+    DBUG_RETURN(rc);
+
+  /* Partition the records of join_tab */
+  rc= NESTED_LOOP_OK;
+  if (!(error= join_tab_scan->open()))
+  {
+    while (!(error= join_tab_scan->next()))
+    {
+      if (unlikely(join->thd->check_killed()))
+      {
+        rc= NESTED_LOOP_KILLED;
+        break;
+      }
+      key_copy(key_buff, table->record[0], keyinfo, key_length, TRUE);
+      if (my_b_write(inner_parts + get_partition(key_buff),
+                     table->record[0], table->s->reclength))
+      {
+        rc= NESTED_LOOP_ERROR;
+        break;
+      }
+    }
+  }
+  join_tab_scan->close();
+  if (rc == NESTED_LOOP_OK && error > 0)
+    rc= NESTED_LOOP_ERROR;
+  if (rc != NESTED_LOOP_OK)
+    DBUG_RETURN(rc);
+
+  for (uint i= 0; i < partitions; i++)
+  {
+    IO_CACHE *outer_part= outer_parts + i;
+    bool eof= FALSE;
+
+    if (!my_b_tell(outer_part) || !my_b_tell(inner_parts + i))
+      continue;
+    if (reinit_io_cache(outer_part, READ_CACHE, 0L, 0, 0))
+      DBUG_RETURN(NESTED_LOOP_ERROR);
+
+    while (!eof)
+    {
+      /* Load as many outer records of the partition as fit */
+      bool is_full= FALSE;
+      reset(TRUE);
+      while (!is_full &&
+             !(eof= my_b_read(outer_part, outer_row, outer_row_length)))
+      {
+        read_outer_row();
+        is_full= JOIN_CACHE_HASHED::put_record();
+      }
+      if (outer_part->error)
+        DBUG_RETURN(NESTED_LOOP_ERROR);
+      if (!records)
+        break;
+      rc= join_partition_records(inner_parts + i);
+      if (rc != NESTED_LOOP_OK && rc != NESTED_LOOP_NO_MORE_ROWS)
+        DBUG_RETURN(rc);
+    }
+  }
+  DBUG_RETURN(NESTED_LOOP_OK);
+}
+
+
+/*
+  Join records from the join buffer with records from join_tab
+
+  SYNOPSIS
+    join_records()
+      skip_last    do not find matches for the last record from the buffer
+
+  DESCRIPTION
+    This implementation of the virtual function join_records performs
+    the partitioned join if the join buffer has been spilled to disk and
+    calls the implementation of the parent class otherwise.
+    The function is called for a spilled buffer only after all partial join
+    records have been received.
+
+  RETURN VALUE
+    return one of enum_nested_loop_state, except NESTED_LOOP_NO_MORE_ROWS.
+*/
+
+enum_nested_loop_state JOIN_CACHE_BNLH::join_records(bool skip_last)
+{
+  enum_nested_loop_state rc;
+  DBUG_ENTER("JOIN_CACHE_BNLH::join_records");
+
+  if (!partitions)
+    DBUG_RETURN(JOIN_CACHE::join_records(skip_last));
+
+  DBUG_ASSERT(!skip_last);
+  rc= spill_error ? NESTED_LOOP_ERROR : join_partitions();
+  if (rc == NESTED_LOOP_NO_MORE_ROWS)
+    rc= NESTED_LOOP_OK;
+  free_partitions();
+  restore_last_record();
+  reset(TRUE);
+  DBUG_RETURN(rc);
+}
+
+
+/*
+  Close the partition files of a spilled BNLH join cache
+
+  SYNOPSIS
+    free_partitions()
+
+  RETURN VALUE
+    none
+*/
+
+void JOIN_CACHE_BNLH::free_partitions()
+{
+  if (!outer_parts)
+    return;
+  for (uint i= 0; i < partitions; i++)
+  {
+    close_cached_file(outer_parts + i);
+    close_cached_file(inner_parts + i);
+  }
+  my_free(outer_parts);
+  outer_parts= 0;
+  partitions= 0;
+}
+
+
+void JOIN_CACHE_BNLH::free()
+{
+  free_partitions();
+  JOIN_CACHE_HASHED::free();
+}
+
+
 /* 
   Calculate the increment of the MRR buffer for a record write       
 
@@ -659,7 +659,7 @@ class JOIN_CACHE :public Sql_alloc
   }
      
   /* Join records from the join buffer with records from the next join table */ 
-  enum_nested_loop_state join_records(bool skip_last);
+  virtual enum_nested_loop_state join_records(bool skip_last);
 
   /* Add a comment on the join algorithm employed by the join cache */
   virtual bool save_explain_data(EXPLAIN_BKA_TYPE *explain);
@@ -668,7 +668,7 @@ class JOIN_CACHE :public Sql_alloc
 
   virtual ~JOIN_CACHE() {}
   void reset_join(JOIN *j) { join= j; }
-  void free()
+  virtual void free()
   { 
     my_free(buff);
     buff= 0;
@@ -849,6 +849,9 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
 
   uint get_size_of_key_offset() { return size_of_key_ofs; }
 
+  /* Get the hash value of a key the hash table index is calculated from */
+  ulong get_hash_value(uchar *key);
+
   /* 
     Get the position of the next_key_ptr field pointed to by 
     a linking reference stored at the position key_ref_ptr. 
@@ -1178,6 +1181,46 @@ class JOIN_CACHE_BNLH :public JOIN_CACHE_HASHED
 
   void read_next_candidate_for_match(uchar *rec_ptr);
 
+  /*
+    The members below are used when the records that do not fit into the
+    join buffer are spilled to disk and the join is completed as a
+    partitioned (Grace) hash join. Partition i of the records from the
+    join buffer is written to outer_parts[i], the records of join_tab with
+    the same hash values of the join key go to inner_parts[i].
+  */
+
+  /* Number of partitions, 0 if the join buffer has not been spilled */
+  uint partitions;
+  IO_CACHE *outer_parts;
+  IO_CACHE *inner_parts;
+  /* Buffer for the record images of the tables whose rows are buffered */
+  uchar *outer_row;
+  uint outer_row_length;
+  /* Set if writing to a partition failed */
+  bool spill_error;
+
+  bool put_record();
+
+  bool can_spill();
+
+  bool start_spill();
+
+  bool write_outer_row();
+
+  void read_outer_row();
+
+  uint get_partition(uchar *key)
+  {
+    /* Use other bits of the hash value than get_hash_idx_*() do */
+    return (uint) (((get_hash_value(key) * 2654435761UL) >> 16) % partitions);
+  }
+
+  enum_nested_loop_state join_partitions();
+
+  enum_nested_loop_state join_partition_records(IO_CACHE *inner_part);
+
+  void free_partitions();
+
 public:
 
   /* 
@@ -1185,7 +1228,8 @@ class JOIN_CACHE_BNLH :public JOIN_CACHE_HASHED
     used to join table 'tab' to the result of joining the previous tables 
     specified by the 'j' parameter.
   */   
-  JOIN_CACHE_BNLH(JOIN *j, JOIN_TAB *tab) : JOIN_CACHE_HASHED(j, tab) {}
+  JOIN_CACHE_BNLH(JOIN *j, JOIN_TAB *tab)
+    : JOIN_CACHE_HASHED(j, tab), partitions(0), outer_parts(0) {}
 
   /* 
     This constructor creates a linked BNLH join cache. The cache is to be 
@@ -1194,7 +1238,7 @@ class JOIN_CACHE_BNLH :public JOIN_CACHE_HASHED
     cache object to which this cache is linked.
   */   
   JOIN_CACHE_BNLH(JOIN *j, JOIN_TAB *tab, JOIN_CACHE *prev) 
-    : JOIN_CACHE_HASHED(j, tab, prev) {}
+    : JOIN_CACHE_HASHED(j, tab, prev), partitions(0), outer_parts(0) {}
 
   /* Initialize the BNLH cache */       
   int init(bool for_explain);
@@ -1203,6 +1247,10 @@ class JOIN_CACHE_BNLH :public JOIN_CACHE_HASHED
 
   bool is_key_access() { return TRUE; }
 
+  enum_nested_loop_state join_records(bool skip_last);
+
+  void free();
+
 };
 
 
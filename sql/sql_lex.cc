@@ -2380,6 +2380,7 @@ void st_select_lex::init_query()
   top_join_list.empty();
   join_list= &top_join_list;
   embedding= 0;
+  saved_join_order_count= 0;
   leaf_tables_prep.empty();
   leaf_tables.empty();
   item_list.empty();
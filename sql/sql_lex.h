@@ -1123,6 +1123,17 @@ class st_select_lex: public st_select_lex_node
   List<TABLE_LIST> *join_list;    /* list for the currently parsed join  */
   TABLE_LIST *embedding;          /* table embedding to the above list   */
   List<TABLE_LIST> sj_nests;      /* Semi-join nests within this join */
+  /*
+    The join order that choose_plan() found for this select by a full
+    search in a prepared statement or a stored routine statement, as
+    TABLE::tablenr of the non-constant tables, and the constant tables and
+    the estimated number of rows of that plan. saved_join_order_count is 0
+    if no join order has been saved.
+  */
+  uchar saved_join_order[MAX_TABLES];
+  uint saved_join_order_count;
+  table_map saved_join_const_tables;
+  double saved_join_rows;
   /*
     Beginning of the list of leaves in a FROM clause, where the leaves
     inlcude all base tables including view tables. The tables are connected
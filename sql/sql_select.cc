@@ -8083,6 +8083,123 @@ static void choose_initial_table_order(JOIN *join)
 }
 
 
+/**
+  Check whether choose_plan() may save and reuse the join order of a join.
+
+  Join orders are only kept for prepared statements and stored routine
+  statements, whose SELECT_LEX survives between executions. Semi-join
+  nests are excluded, because their strategies are chosen together with
+  the join order.
+*/
+
+static bool join_order_reuse_allowed(JOIN *join)
+{
+  THD *thd= join->thd;
+  return thd->variables.optimizer_reuse_join_order &&
+         !thd->stmt_arena->is_conventional() &&
+         !join->emb_sjm_nest &&
+         join->select_lex->sj_nests.is_empty();
+}
+
+
+/**
+  Estimate the number of rows of the join plan in join->best_positions.
+*/
+
+static double join_plan_rows(JOIN *join)
+{
+  double rows= 1.0;
+  for (uint i= join->const_tables; i < join->table_count; i++)
+    rows= COST_MULT(rows, join->best_positions[i].records_read);
+  return rows;
+}
+
+
+/**
+  Remember the join order found by a full search, so that the next
+  execution of the statement can skip the search.
+*/
+
+static void save_join_order(JOIN *join)
+{
+  SELECT_LEX *sel= join->select_lex;
+  uint n_tables= join->table_count - join->const_tables;
+
+  if (!join_order_reuse_allowed(join))
+    return;
+
+  for (uint i= 0; i < n_tables; i++)
+    sel->saved_join_order[i]= (uchar)
+      join->best_positions[join->const_tables + i].table->table->tablenr;
+  sel->saved_join_order_count= n_tables;
+  sel->saved_join_const_tables= join->const_table_map;
+  sel->saved_join_rows= join_plan_rows(join);
+}
+
+
+/**
+  Try to build the plan in the join order that was saved by an earlier
+  execution of the statement.
+
+  The tables are put into the saved order and only the access methods are
+  chosen, as for STRAIGHT_JOIN. The saved order is not used if the
+  constant tables differ, or if the estimated number of rows of the new
+  plan differs from the saved plan by more than
+  JOIN_ORDER_REUSE_MAX_ROWS_RATIO, e.g. because the range estimates for
+  the new parameter values are different. Then the caller does a full
+  search, which saves the order it finds.
+
+  @param join         the join
+  @param join_tables  set of the tables in the query
+
+  @retval true   the plan was built in the saved join order
+  @retval false  the saved join order cannot be used; join->best_ref is
+                 unchanged
+*/
+
+static bool reuse_join_order(JOIN *join, table_map join_tables)
+{
+  SELECT_LEX *sel= join->select_lex;
+  uint n_tables= join->table_count - join->const_tables;
+  JOIN_TAB **ref= join->best_ref + join->const_tables;
+  JOIN_TAB *orig_ref[MAX_TABLES];
+
+  if (!n_tables || sel->saved_join_order_count != n_tables ||
+      sel->saved_join_const_tables != join->const_table_map ||
+      !join_order_reuse_allowed(join))
+    return false;
+
+  memcpy(orig_ref, ref, sizeof(JOIN_TAB*) * n_tables);
+
+  for (uint i= 0; i < n_tables; i++)
+  {
+    uint j= i;
+    while (ref[j]->table->tablenr != sel->saved_join_order[i])
+    {
+      if (++j == n_tables)
+        goto restore;
+    }
+    swap_variables(JOIN_TAB*, ref[i], ref[j]);
+  }
+
+  optimize_straight_join(join, join_tables);
+
+  {
+    double rows= join_plan_rows(join);
+    if (rows <= sel->saved_join_rows * JOIN_ORDER_REUSE_MAX_ROWS_RATIO &&
+        rows * JOIN_ORDER_REUSE_MAX_ROWS_RATIO >= sel->saved_join_rows)
+    {
+      status_var_increment(join->thd->status_var.select_reused_join_order);
+      return true;
+    }
+  }
+
+restore:
+  memcpy(ref, orig_ref, sizeof(JOIN_TAB*) * n_tables);
+  return false;
+}
+
+
 /**
   Selects and invokes a search strategy for an optimal query plan.
 
@@ -8160,7 +8277,7 @@ choose_plan(JOIN *join, table_map join_tables)
   {
     optimize_straight_join(join, join_tables);
   }
-  else
+  else if (!reuse_join_order(join, join_tables))
   {
     DBUG_ASSERT(search_depth <= MAX_TABLES + 1);
     if (search_depth == 0)
@@ -8169,6 +8286,7 @@ choose_plan(JOIN *join, table_map join_tables)
     if (greedy_search(join, join_tables, search_depth, prune_level,
                       use_cond_selectivity))
       DBUG_RETURN(TRUE);
+    save_join_order(join);
   }
 
   /* 
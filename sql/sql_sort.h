@@ -80,6 +80,10 @@ class Sort_param {
   SORT_ADDON_FIELD *addon_field; // Descriptors for companion fields.
   LEX_STRING addon_buf;          // Buffer & length of added packed fields.
 
+  uint max_sort_threads;      // Max threads for sorting a buffer.
+  uint sort_threads_used;     // Max slices a buffer was sorted in.
+  ulong parallel_sorts;       // Number of buffers sorted in parallel.
+
   uchar *unique_buff;
   bool not_killable;
   char* tmp_buffer;
@@ -93,9 +97,38 @@ class Sort_param {
   }
   void init_for_filesort(uint sortlen, TABLE *table,
                          ha_rows maxrows, bool sort_positions);
+
+  /*
+    With packed sort keys every record starts with the length of its sort
+    key (including the length field itself), followed by the key parts
+    and then res_length bytes of addon fields or record reference.
+    sort_length and rec_length are then the maximum possible lengths.
+  */
+  static const uint size_of_length_field= 4;
+
+  void set_using_packed_sortkeys(bool val) { using_packed_sortkeys_= val; }
+  bool using_packed_sortkeys() const { return using_packed_sortkeys_; }
+
+  /* Offset of the addon fields or record reference in the record */
+  uint get_sort_length(const uchar *key) const
+  {
+    return using_packed_sortkeys_ ? uint4korr(key) : rec_length - res_length;
+  }
+
+  /* Length of the record that starts at 'key' */
+  uint get_record_length(const uchar *key) const
+  {
+    return using_packed_sortkeys_ ? uint4korr(key) + res_length : rec_length;
+  }
+
+private:
+  bool using_packed_sortkeys_;
 };
 
 
+int compare_packed_sort_keys(void *sort_param, uchar **a, uchar **b);
+
+
 int merge_many_buff(Sort_param *param, uchar *sort_buffer,
 		    BUFFPEK *buffpek,
 		    uint *maxbuffer, IO_CACHE *t_file);
@@ -3724,6 +3724,11 @@ class Type_handler
   virtual void make_sort_key(uchar *to, Item *item,
                              const SORT_FIELD_ATTR *sort_field,
                              Sort_param *param) const= 0;
+  /*
+    Whether filesort can store values of this type as packed sort keys,
+    i.e. as the original value with a length prefix, compared by collation.
+  */
+  virtual bool is_packable() const { return false; }
   virtual void sortlength(THD *thd,
                           const Type_std_attributes *item,
                           SORT_FIELD_ATTR *attr) const= 0;
@@ -5002,6 +5007,7 @@ class Type_handler_string_result: public Type_handler
                                             CHARSET_INFO *cs) const override;
   void make_sort_key(uchar *to, Item *item, const SORT_FIELD_ATTR *sort_field,
                      Sort_param *param) const override;
+  bool is_packable() const override { return true; }
   void sortlength(THD *thd,
                   const Type_std_attributes *item,
                   SORT_FIELD_ATTR *attr) const override;
@@ -6836,6 +6842,8 @@ class Type_handler_typelib: public Type_handler_general_purpose_string
   enum_field_types field_type() const override { return MYSQL_TYPE_STRING; }
   const Type_handler *type_handler_for_item_field() const override;
   const Type_handler *cast_to_int_type_handler() const override;
+  /* ENUM and SET fields are sorted by their numeric value */
+  bool is_packable() const override { return false; }
   uint32 max_display_length_for_field(const Conv_source &src) const override;
   bool Item_hybrid_func_fix_attributes(THD *thd,
                                        const char *name,
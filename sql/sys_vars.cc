@@ -2342,6 +2342,14 @@ static Sys_var_ulong Sys_max_sort_length(
        SESSION_VAR(max_sort_length), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(4, 8192*1024L), DEFAULT(1024), BLOCK_SIZE(1));
 
+static Sys_var_uint Sys_max_sort_threads(
+       "max_sort_threads",
+       "The maximum number of threads used to sort one sort buffer. Large "
+       "sort buffers are split into slices that are sorted and merged in "
+       "parallel. 1 means that sorting is done by the connection thread only",
+       SESSION_VAR(max_sort_threads), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(1, MAX_SORT_THREADS), DEFAULT(1), BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_max_sp_recursion_depth(
        "max_sp_recursion_depth",
        "Maximum stored procedure recursion depth",
@@ -2516,6 +2524,15 @@ static Sys_var_ulong Sys_optimizer_prune_level(
        SESSION_VAR(optimizer_prune_level), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, 1), DEFAULT(1), BLOCK_SIZE(1));
 
+static Sys_var_mybool Sys_optimizer_reuse_join_order(
+       "optimizer_reuse_join_order",
+       "Reuse the join order chosen by an earlier execution of a prepared "
+       "statement or a statement of a stored routine, as long as the "
+       "estimated number of rows of the join does not change much. Access "
+       "methods are still chosen anew for every execution",
+       SESSION_VAR(optimizer_reuse_join_order), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static Sys_var_ulong Sys_optimizer_selectivity_sampling_limit(
        "optimizer_selectivity_sampling_limit",
        "Controls number of record samples to check condition selectivity",
@@ -6094,6 +6111,16 @@ static Sys_var_ulonglong Sys_join_buffer_space_limit(
        VALID_RANGE(2048, ULONGLONG_MAX), DEFAULT(16*128*1024),
        BLOCK_SIZE(2048));
 
+static Sys_var_uint Sys_hash_join_max_partitions(
+       "hash_join_max_partitions",
+       "The maximum number of partitions used when the join buffer of a "
+       "BNLH join overflows and the rest of the join is done as a partitioned "
+       "hash join over temporary files. 0 disables partitioning: then the "
+       "joined table is scanned once for every refill of the join buffer. "
+       "Partitioning needs at least 2 partitions, so 1 is treated as 0",
+       SESSION_VAR(hash_join_max_partitions), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, 1024), DEFAULT(0), BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_progress_report_time(
        "progress_report_time",
        "Seconds between sending progress reports to the client for "
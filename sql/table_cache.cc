@@ -50,6 +50,9 @@
 #include "lf.h"
 #include "table.h"
 #include "sql_base.h"
+#ifdef HAVE_SCHED_GETCPU
+#include <sched.h>
+#endif
 
 
 /** Configuration. */
@@ -121,7 +124,7 @@ struct Table_cache_instance
   /**
     Protects free_tables (TABLE::global_free_next and TABLE::global_free_prev),
     records, Share_free_tables::List (TABLE::prev and TABLE::next),
-    TABLE::in_use.
+    TABLE::in_use, lock_requests, lock_waits.
   */
   mysql_mutex_t LOCK_table_cache;
   I_P_List <TABLE, I_P_List_adapter<TABLE, &TABLE::global_free_next,
@@ -131,13 +134,28 @@ struct Table_cache_instance
   ulong records;
   uint mutex_waits;
   uint mutex_nowaits;
+  /**
+    Cumulative contention statistics, reset by FLUSH STATUS only. Unlike
+    mutex_waits and mutex_nowaits these are not reset by instance activation
+    heuristic.
+  */
+  ulonglong lock_requests;
+  ulonglong lock_waits;
+  /** Instance number and statistics exposed via SHOW STATUS */
+  char status_name[11];
+  SHOW_VAR status[3];
   /** Avoid false sharing between instances */
   char pad[CPU_LEVEL1_DCACHE_LINESIZE];
 
-  Table_cache_instance(): records(0), mutex_waits(0), mutex_nowaits(0)
+  Table_cache_instance(): records(0), mutex_waits(0), mutex_nowaits(0),
+                          lock_requests(0), lock_waits(0)
   {
     mysql_mutex_init(key_LOCK_table_cache, &LOCK_table_cache,
                      MY_MUTEX_INIT_FAST);
+    status_name[0]= 0;
+    status[0]= { "lock_requests", (char*) &lock_requests, SHOW_ULONGLONG };
+    status[1]= { "lock_waits", (char*) &lock_waits, SHOW_ULONGLONG };
+    status[2]= { NullS, NullS, SHOW_LONG };
   }
 
   ~Table_cache_instance()
@@ -168,6 +186,7 @@ struct Table_cache_instance
     if (mysql_mutex_trylock(&LOCK_table_cache))
     {
       mysql_mutex_lock(&LOCK_table_cache);
+      lock_waits++;
       if (++mutex_waits == 20000)
       {
         if (n_instances < tc_instances)
@@ -208,6 +227,7 @@ struct Table_cache_instance
       mutex_waits= 0;
       mutex_nowaits= 0;
     }
+    lock_requests++;
   }
 };
 
@@ -215,6 +235,27 @@ struct Table_cache_instance
 static Table_cache_instance *tc;
 
 
+/**
+  Pick table cache instance for current thread.
+
+  Threads running on the same CPU share an instance: table cache mutex
+  cache line mostly stays local to that CPU and TABLE objects released by
+  one connection are reused by the next one scheduled on the same CPU, which
+  matters for short lived connections. Thread id is used if CPU number is
+  not available.
+*/
+
+static inline uint32 tc_instance(THD *thd, uint32 n_instances)
+{
+#ifdef HAVE_SCHED_GETCPU
+  int cpu= sched_getcpu();
+  if (cpu >= 0)
+    return (uint32) cpu % n_instances;
+#endif
+  return thd->thread_id % n_instances;
+}
+
+
 static void intern_close_table(TABLE *table)
 {
   delete table->triggers;
@@ -225,6 +266,43 @@ static void intern_close_table(TABLE *table)
 }
 
 
+/**
+  Fill SHOW STATUS array with contention statistics of active instances.
+
+  @param vars  array of at least tc_instances + 1 elements
+*/
+
+void tc_status_vars(SHOW_VAR *vars)
+{
+  uint32 n_instances=
+    my_atomic_load32_explicit((int32*) &tc_active_instances,
+                              MY_MEMORY_ORDER_RELAXED);
+  for (uint32 i= 0; i < n_instances; i++)
+  {
+    vars[i].name= tc[i].status_name;
+    vars[i].value= (char*) tc[i].status;
+    vars[i].type= SHOW_ARRAY;
+  }
+  vars[n_instances].name= NullS;
+}
+
+
+/**
+  Reset contention statistics of all instances (FLUSH STATUS).
+*/
+
+void tc_reset_status(void)
+{
+  for (uint32 i= 0; i < tc_instances; i++)
+  {
+    mysql_mutex_lock(&tc[i].LOCK_table_cache);
+    tc[i].lock_requests= 0;
+    tc[i].lock_waits= 0;
+    mysql_mutex_unlock(&tc[i].LOCK_table_cache);
+  }
+}
+
+
 /**
   Get number of TABLE objects (used and unused) in table cache.
 */
@@ -354,8 +432,9 @@ void tc_purge(bool mark_flushed)
 
 void tc_add_table(THD *thd, TABLE *table)
 {
-  uint32 i= thd->thread_id % my_atomic_load32_explicit((int32*) &tc_active_instances,
-                                                       MY_MEMORY_ORDER_RELAXED);
+  uint32 i= tc_instance(thd,
+                        my_atomic_load32_explicit((int32*) &tc_active_instances,
+                                                  MY_MEMORY_ORDER_RELAXED));
   TABLE *LRU_table= 0;
   TDC_element *element= table->s->tdc;
 
@@ -411,7 +490,7 @@ TABLE *tc_acquire_table(THD *thd, TDC_element *element)
   uint32 n_instances=
     my_atomic_load32_explicit((int32*) &tc_active_instances,
                               MY_MEMORY_ORDER_RELAXED);
-  uint32 i= thd->thread_id % n_instances;
+  uint32 i= tc_instance(thd, n_instances);
   TABLE *table;
 
   tc[i].lock_and_check_contention(n_instances, i);
@@ -621,6 +700,8 @@ bool tdc_init(void)
   /* Extra instance is allocated to avoid false sharing */
   if (!(tc= new Table_cache_instance[tc_instances + 1]))
     DBUG_RETURN(true);
+  for (uint32 i= 0; i < tc_instances; i++)
+    my_snprintf(tc[i].status_name, sizeof(tc[i].status_name), "%u", i + 1);
   tdc_inited= true;
   mysql_mutex_init(key_LOCK_unused_shares, &LOCK_unused_shares,
                    MY_MUTEX_INIT_FAST);
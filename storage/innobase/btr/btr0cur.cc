@@ -793,6 +793,81 @@ btr_cur_optimistic_latch_leaves(
 	}
 }
 
+/** Position a tree cursor on a guessed leaf page for inserting a tuple,
+without descending from the root. This succeeds if the page has not
+been modified by anything else than inserts since the guess was made,
+and the tuple falls inside the page, so that the search from the root
+would end on the page as well.
+@param[in]	index	B-tree index
+@param[in]	tuple	tuple to be inserted
+@param[in]	guess	guessed leaf page
+@param[out]	cursor	cursor positioned as with PAGE_CUR_LE
+@param[in,out]	mtr	mini-transaction
+@return whether the cursor was positioned on an X-latched page */
+bool
+btr_cur_search_leaf_guess(
+	dict_index_t*		index,
+	const dtuple_t*		tuple,
+	const btr_leaf_guess_t&	guess,
+	btr_cur_t*		cursor,
+	mtr_t*			mtr)
+{
+	ut_ad(!dict_index_is_spatial(index));
+	ut_ad(!dict_index_is_ibuf(index));
+
+	buf_block_t*	block = guess.block;
+
+	if (!block || buf_pool_is_obsolete(guess.withdraw_clock)) {
+		return(false);
+	}
+
+	const ulint	savepoint = mtr_set_savepoint(mtr);
+
+	if (!buf_page_optimistic_get(RW_X_LATCH, block, guess.modify_clock,
+				     __FILE__, __LINE__, mtr)) {
+		return(false);
+	}
+
+	const page_t*	page = buf_block_get_frame(block);
+
+	if (!page_is_leaf(page)
+	    || btr_page_get_index_id(page) != index->id
+	    || block->page.id.space() != index->table->space_id) {
+		goto fail;
+	}
+
+	buf_block_dbg_add_level(block, SYNC_TREE_NODE);
+
+	cursor->index = index;
+	cursor->flag = BTR_CUR_BINARY;
+	cursor->up_match = 0;
+	cursor->low_match = 0;
+	cursor->up_bytes = 0;
+	cursor->low_bytes = 0;
+
+	page_cur_search_with_match(block, index, tuple, PAGE_CUR_LE,
+				   &cursor->up_match, &cursor->low_match,
+				   btr_cur_get_page_cur(cursor), NULL);
+
+	{
+		const rec_t*	rec = btr_cur_get_rec(cursor);
+
+		/* If the tuple could belong to a neighbour page,
+		only a search from the root can tell. */
+		if (page_rec_is_infimum(rec)
+		    ? page_has_prev(page)
+		    : (page_rec_is_supremum(page_rec_get_next_const(rec))
+		       && page_has_next(page))) {
+			goto fail;
+		}
+	}
+
+	return(true);
+fail:
+	mtr_release_block_at_savepoint(mtr, savepoint, block);
+	return(false);
+}
+
 /**
 Gets intention in btr_intention_t from latch_mode, and cleares the intention
 at the latch_mode.
@@ -3463,7 +3538,9 @@ btr_cur_optimistic_insert(
 			ut_ad(trx_id[1].len == DATA_ROLL_PTR_LEN);
 			ut_ad(*static_cast<const byte*>
 			      (trx_id[1].data) & 0x80);
-			if (flags & BTR_NO_UNDO_LOG_FLAG) {
+			if ((flags & (BTR_NO_UNDO_LOG_FLAG
+				      | BTR_BULK_INSERT_FLAG))
+			    == BTR_NO_UNDO_LOG_FLAG) {
 				ut_ad(!memcmp(trx_id->data, reset_trx_id,
 					      DATA_TRX_ID_LEN));
 			} else {
@@ -3642,7 +3719,8 @@ btr_cur_pessimistic_insert(
 		return(err);
 	}
 
-	if (!(flags & BTR_NO_UNDO_LOG_FLAG)) {
+	if ((flags & (BTR_NO_UNDO_LOG_FLAG | BTR_BULK_INSERT_FLAG))
+	    != BTR_NO_UNDO_LOG_FLAG) {
 		/* First reserve enough free space for the file segments
 		of the index tree, so that the insert will not fail because
 		of lack of space */
@@ -74,6 +74,11 @@ rw_lock_t**	btr_search_latches;
 the same memory cache line */
 UNIV_INTERN byte		btr_sea_pad2[CACHE_LINE_SIZE];
 
+/** Number of threads in btr_search_guess_optimistic(), which accesses
+the hash tables without holding btr_search_latches. Each thread
+increments and decrements the same slot. */
+static ib_counter_t<ulint>	btr_search_n_optimistic;
+
 /** The adaptive hash index */
 btr_search_sys_t*	btr_search_sys;
 
@@ -375,6 +380,15 @@ void btr_search_disable(bool need_mutex)
 
 	btr_search_enabled = false;
 
+	/* Wait for the lookups that did not see btr_search_enabled=false
+	to finish. They may be reading any hash node without holding a
+	latch, so the nodes must not be freed before that. */
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	while (btr_search_n_optimistic) {
+		os_thread_yield();
+	}
+
 	/* Clear the index->search_info->ref_count of every index in
 	the data dictionary cache. */
 	for (table = UT_LIST_GET_FIRST(dict_sys.table_LRU); table;
@@ -400,6 +414,7 @@ void btr_search_disable(bool need_mutex)
 	for (ulint i = 0; i < btr_ahi_parts; ++i) {
 		hash_table_clear(btr_search_sys->hash_tables[i]);
 		mem_heap_empty(btr_search_sys->hash_tables[i]->heap);
+		btr_search_sys->hash_tables[i]->free_nodes = NULL;
 	}
 
 	btr_search_x_unlock_all();
@@ -850,6 +865,128 @@ btr_search_failure(btr_search_t* info, btr_cur_t* cursor)
 	info->last_hash_succ = FALSE;
 }
 
+/** Outcome of btr_search_guess_optimistic() */
+enum btr_search_optimistic_t {
+	/** the fold value was not found, or the page could not be latched */
+	BTR_SEARCH_OPTIMISTIC_FAIL,
+	/** the record was found and its page was latched */
+	BTR_SEARCH_OPTIMISTIC_FOUND,
+	/** the hash table was modified concurrently */
+	BTR_SEARCH_OPTIMISTIC_RETRY
+};
+
+/** Look up the adaptive hash index without acquiring btr_search_latches,
+and buffer-fix and latch the page that the hash index points to.
+The result is valid if the hash table was not modified between the lookup
+and the acquisition of the page latch: this is equivalent to holding the
+S-latch on the partition during that time.
+@param[in]	index		index tree
+@param[in]	fold		folded search tuple
+@param[in]	latch_mode	BTR_SEARCH_LEAF or BTR_MODIFY_LEAF
+@param[out]	rec		the record that the hash index points to
+@param[out]	block		the page containing rec
+@param[in,out]	mtr		mini-transaction
+@return	outcome of the lookup */
+static
+btr_search_optimistic_t
+btr_search_guess_optimistic(
+	dict_index_t*	index,
+	ulint		fold,
+	ulint		latch_mode,
+	const rec_t**	rec,
+	buf_block_t**	block,
+	mtr_t*		mtr)
+{
+	btr_search_optimistic_t	ret = BTR_SEARCH_OPTIMISTIC_RETRY;
+	const size_t		slot = get_rnd_value();
+
+	/* Announce the access to the hash table before checking
+	btr_search_enabled. See btr_search_disable(). */
+	btr_search_n_optimistic.add(slot, 1);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (!btr_search_enabled) {
+		goto func_exit;
+	}
+
+	{
+		hash_table_t*	table = btr_get_search_table(index);
+		const std::atomic<ulint>& chain_seq = ha_seq(table, fold);
+		const ulint	seq = chain_seq.load(
+			std::memory_order_acquire);
+
+		if ((seq & 1)
+		    || !ha_search_and_get_data_optimistic(
+			    table, fold, seq, rec)) {
+			goto func_exit;
+		}
+
+		if (*rec == NULL) {
+			ret = BTR_SEARCH_OPTIMISTIC_FAIL;
+			goto func_exit;
+		}
+
+		buf_block_t*	b = buf_block_from_ahi(*rec);
+
+		mutex_enter(&b->mutex);
+
+		if (buf_block_get_state(b) != BUF_BLOCK_FILE_PAGE) {
+			/* The block is being freed, or it was freed
+			after the lookup. */
+			mutex_exit(&b->mutex);
+			goto func_exit;
+		}
+
+		buf_block_buf_fix_inc(b, __FILE__, __LINE__);
+		mutex_exit(&b->mutex);
+
+		const mtr_memo_type_t	fix_type = latch_mode == BTR_SEARCH_LEAF
+			? MTR_MEMO_PAGE_S_FIX : MTR_MEMO_PAGE_X_FIX;
+
+		if (fix_type == MTR_MEMO_PAGE_S_FIX
+		    ? !rw_lock_s_lock_nowait(&b->lock, __FILE__, __LINE__)
+		    : !rw_lock_x_lock_func_nowait_inline(
+			    &b->lock, __FILE__, __LINE__)) {
+			buf_block_buf_fix_dec(b);
+			ret = BTR_SEARCH_OPTIMISTIC_FAIL;
+			goto func_exit;
+		}
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (chain_seq.load(std::memory_order_relaxed) != seq) {
+			if (fix_type == MTR_MEMO_PAGE_S_FIX) {
+				rw_lock_s_unlock(&b->lock);
+			} else {
+				rw_lock_x_unlock(&b->lock);
+			}
+			buf_block_buf_fix_dec(b);
+			goto func_exit;
+		}
+
+		ut_ad(!b->page.file_page_was_freed);
+		mtr->memo_push(b, fix_type);
+
+		buf_pool_t*	buf_pool = buf_pool_from_block(b);
+
+		mutex_enter(&b->mutex);
+		buf_page_set_accessed(&b->page);
+		mutex_exit(&b->mutex);
+
+		buf_page_make_young_if_needed(buf_pool, &b->page);
+		buf_pool->stat.n_page_gets++;
+
+		buf_block_dbg_add_level(b, SYNC_TREE_NODE_FROM_HASH);
+
+		*block = b;
+		ret = BTR_SEARCH_OPTIMISTIC_FOUND;
+	}
+
+func_exit:
+	btr_search_n_optimistic.add(slot, ulint(-1));
+	return(ret);
+}
+
 /** Tries to guess the right search position based on the hash search info
 of the index. Note that if mode is PAGE_CUR_LE, which is used in inserts,
 and the function returns TRUE, then cursor->up_match and cursor->low_match
@@ -928,8 +1065,20 @@ btr_search_guess_on_hash(
 	cursor->flag = BTR_CUR_HASH;
 
 	rw_lock_t* use_latch = ahi_latch ? NULL : btr_get_search_latch(index);
+	buf_block_t* block;
 
 	if (use_latch) {
+		switch (btr_search_guess_optimistic(index, fold, latch_mode,
+						    &rec, &block, mtr)) {
+		case BTR_SEARCH_OPTIMISTIC_FAIL:
+			btr_search_failure(info, cursor);
+			return(FALSE);
+		case BTR_SEARCH_OPTIMISTIC_FOUND:
+			goto got_block;
+		case BTR_SEARCH_OPTIMISTIC_RETRY:
+			break;
+		}
+
 		rw_lock_s_lock(use_latch);
 
 		if (!btr_search_enabled) {
@@ -954,10 +1103,11 @@ btr_search_guess_on_hash(
 		return(FALSE);
 	}
 
-	buf_block_t* block = buf_block_from_ahi(rec);
-	buf_pool_t* buf_pool = buf_pool_from_block(block);
+	block = buf_block_from_ahi(rec);
 
 	if (use_latch) {
+		buf_pool_t* buf_pool = buf_pool_from_block(block);
+
 		mutex_enter(&block->mutex);
 
 		if (buf_block_get_state(block) == BUF_BLOCK_REMOVE_HASH) {
@@ -1000,6 +1150,7 @@ btr_search_guess_on_hash(
 		buf_block_dbg_add_level(block, SYNC_TREE_NODE_FROM_HASH);
 	}
 
+got_block:
 	if (buf_block_get_state(block) != BUF_BLOCK_FILE_PAGE) {
 
 		ut_ad(buf_block_get_state(block) == BUF_BLOCK_REMOVE_HASH);
@@ -1084,6 +1235,7 @@ btr_search_guess_on_hash(
 #endif
 	/* Increment the page get statistics though we did not really
 	fix the page: for user info only */
+	buf_pool_t* buf_pool = buf_pool_from_block(block);
 	++buf_pool->stat.n_page_gets;
 
 	if (!ahi_latch) {
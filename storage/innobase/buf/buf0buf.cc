@@ -71,6 +71,10 @@ Created 11/5/1995 Heikki Tuuri
 #include <stdlib.h>
 #endif
 
+#ifdef HAVE_IO_URING
+#include <sys/uio.h>
+#endif
+
 #ifdef HAVE_LZO
 #include "lzo/lzo1x.h"
 #endif
@@ -2103,6 +2107,30 @@ buf_pool_free_instance(
 	buf_pool->allocator.~ut_allocator();
 }
 
+#ifdef HAVE_IO_URING
+/** Register the memory of all buffer pool chunks for fixed-buffer
+reads and writes with io_uring. */
+static void buf_pool_register_io_buffers()
+{
+	std::vector<iovec>	iov;
+
+	for (ulint i = 0; i < srv_buf_pool_instances; i++) {
+		const buf_pool_t*	buf_pool = buf_pool_from_array(i);
+		const buf_chunk_t*	chunk = buf_pool->chunks;
+
+		for (ulint j = buf_pool->n_chunks; j--; chunk++) {
+			iovec	v;
+
+			v.iov_base = chunk->mem;
+			v.iov_len = chunk->mem_size();
+			iov.push_back(v);
+		}
+	}
+
+	os_aio_register_buffers(iov.empty() ? NULL : &iov[0], iov.size());
+}
+#endif /* HAVE_IO_URING */
+
 /********************************************************************//**
 Creates the buffer pool.
 @return DB_SUCCESS if success, DB_ERROR if not enough memory or error */
@@ -2149,6 +2177,10 @@ buf_pool_init(
 
 	btr_search_sys_create(buf_pool_get_curr_size() / sizeof(void*) / 64);
 
+#ifdef HAVE_IO_URING
+	buf_pool_register_io_buffers();
+#endif /* HAVE_IO_URING */
+
 	return(DB_SUCCESS);
 }
 
@@ -2902,6 +2934,13 @@ buf_pool_resize()
 	/* Indicate critical path */
 	buf_pool_resizing = true;
 
+#ifdef HAVE_IO_URING
+	/* Chunks may be freed, and the memory of new ones may be
+	mapped at the same address. Until the chunks are registered
+	again, the I/O will not use registered buffers. */
+	os_aio_register_buffers(NULL, 0);
+#endif /* HAVE_IO_URING */
+
 	/* Acquire all buf_pool_mutex/hash_lock */
 	for (ulint i = 0; i < srv_buf_pool_instances; ++i) {
 		buf_pool_t*	buf_pool = buf_pool_from_array(i);
@@ -3125,6 +3164,10 @@ buf_pool_resize()
 
 	buf_pool_resizing = false;
 
+#ifdef HAVE_IO_URING
+	buf_pool_register_io_buffers();
+#endif /* HAVE_IO_URING */
+
 	/* Normalize other components, if the new size is too different */
 	if (!warning && new_size_too_diff) {
 		srv_buf_pool_base_size = srv_buf_pool_size;
@@ -6848,6 +6891,17 @@ buf_stats_aggregate_pool_info(
 	total_info->io_cur += pool_info->io_cur;
 	total_info->unzip_sum += pool_info->unzip_sum;
 	total_info->unzip_cur += pool_info->unzip_cur;
+	if (!total_info->oldest_modification
+	    || (pool_info->oldest_modification
+		&& pool_info->oldest_modification
+		< total_info->oldest_modification)) {
+		total_info->oldest_modification
+			= pool_info->oldest_modification;
+	}
+	total_info->n_pc_passes += pool_info->n_pc_passes;
+	total_info->n_pc_flushed_lru += pool_info->n_pc_flushed_lru;
+	total_info->n_pc_flushed_list += pool_info->n_pc_flushed_list;
+	total_info->pc_flush_time += pool_info->pc_flush_time;
 }
 /*******************************************************************//**
 Collect buffer pool stats information for a buffer pool. Also
@@ -6899,6 +6953,11 @@ buf_stats_get_pool_info(
 		 (buf_pool->n_flush[BUF_FLUSH_SINGLE_PAGE]
 		  + buf_pool->init_flush[BUF_FLUSH_SINGLE_PAGE]);
 
+	const buf_page_t*	bpage = UT_LIST_GET_LAST(buf_pool->flush_list);
+
+	pool_info->oldest_modification = bpage
+		? bpage->oldest_modification : 0;
+
 	buf_flush_list_mutex_exit(buf_pool);
 
 	current_time = time(NULL);
@@ -6981,6 +7040,14 @@ buf_stats_get_pool_info(
 
 	pool_info->unzip_cur = buf_LRU_stat_cur.unzip;
 
+	pool_info->n_pc_passes = buf_pool->stat.n_pc_passes;
+
+	pool_info->n_pc_flushed_lru = buf_pool->stat.n_pc_flushed_lru;
+
+	pool_info->n_pc_flushed_list = buf_pool->stat.n_pc_flushed_list;
+
+	pool_info->pc_flush_time = buf_pool->stat.pc_flush_time;
+
 	buf_refresh_io_stats(buf_pool);
 	buf_pool_mutex_exit(buf_pool);
 }
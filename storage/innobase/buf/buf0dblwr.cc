@@ -34,6 +34,8 @@ Created 2011/12/19
 #include "fil0crypt.h"
 #include "fil0pagecompress.h"
 
+#include <algorithm>
+
 /** The doublewrite buffer */
 buf_dblwr_t*	buf_dblwr = NULL;
 
@@ -133,11 +135,42 @@ buf_dblwr_init(
 
 	mutex_create(LATCH_ID_BUF_DBLWR, &buf_dblwr->mutex);
 
-	buf_dblwr->b_event = os_event_create("dblwr_batch_event");
 	buf_dblwr->s_event = os_event_create("dblwr_single_event");
-	buf_dblwr->first_free = 0;
 	buf_dblwr->s_reserved = 0;
-	buf_dblwr->b_reserved = 0;
+
+	/* Split the batch flush area between the buffer pool instances,
+	so that their page cleaners can post and write batches at the
+	same time. Whenever a shard fills up, it is written and the
+	system tablespace fsynced, so a shard should hold the whole flush
+	list batch of an instance, which is about innodb_io_capacity
+	divided by the number of instances. The area is only split if it
+	holds more than one such batch, and into at most
+	innodb_doublewrite_shards parts. */
+	const ulint	batch = std::max<ulint>(
+		srv_io_capacity / srv_buf_pool_instances,
+		BUF_DBLWR_MIN_SHARD_SIZE);
+	ulint	n_shards = std::min<ulint>(
+		std::min<ulint>(srv_buf_pool_instances,
+				srv_doublewrite_shards),
+		srv_doublewrite_batch_size / batch);
+
+	n_shards = std::max<ulint>(n_shards, 1);
+
+	buf_dblwr->n_shards = n_shards;
+	buf_dblwr->shards = static_cast<buf_dblwr_shard_t*>(
+		ut_zalloc_nokey(n_shards * sizeof *buf_dblwr->shards));
+
+	for (ulint i = 0, start = 0; i < n_shards; i++) {
+		buf_dblwr_shard_t*	shard = &buf_dblwr->shards[i];
+
+		mutex_create(LATCH_ID_BUF_DBLWR, &shard->mutex);
+		shard->b_event = os_event_create("dblwr_batch_event");
+		shard->start = start;
+		shard->size = (srv_doublewrite_batch_size - start)
+			/ (n_shards - i);
+		start += shard->size;
+		ut_ad(start <= srv_doublewrite_batch_size);
+	}
 
 	buf_dblwr->block1 = mach_read_from_4(
 		doublewrite + TRX_SYS_DOUBLEWRITE_BLOCK1);
@@ -156,6 +189,19 @@ buf_dblwr_init(
 
 	buf_dblwr->buf_block_arr = static_cast<buf_page_t**>(
 		ut_zalloc_nokey(buf_size * sizeof(void*)));
+
+	buf_dblwr->space_ids = static_cast<ulint*>(
+		ut_zalloc_nokey(srv_doublewrite_batch_size
+				* sizeof *buf_dblwr->space_ids));
+
+	buf_dblwr->s_free = static_cast<ulint*>(
+		ut_malloc_nokey((buf_size - srv_doublewrite_batch_size)
+				* sizeof *buf_dblwr->s_free));
+
+	/* Hand out the single page flush slots in ascending order. */
+	for (ulint i = buf_size; i-- > srv_doublewrite_batch_size; ) {
+		buf_dblwr->s_free[buf_size - 1 - i] = i;
+	}
 }
 
 /** Create the doublewrite buffer if the doublewrite buffer header
@@ -708,9 +754,18 @@ buf_dblwr_free()
 	/* Free the double write data structures. */
 	ut_a(buf_dblwr != NULL);
 	ut_ad(buf_dblwr->s_reserved == 0);
-	ut_ad(buf_dblwr->b_reserved == 0);
 
-	os_event_destroy(buf_dblwr->b_event);
+	for (ulint i = 0; i < buf_dblwr->n_shards; i++) {
+		buf_dblwr_shard_t*	shard = &buf_dblwr->shards[i];
+
+		ut_ad(shard->b_reserved == 0);
+		os_event_destroy(shard->b_event);
+		mutex_free(&shard->mutex);
+	}
+
+	ut_free(buf_dblwr->shards);
+	buf_dblwr->shards = NULL;
+
 	os_event_destroy(buf_dblwr->s_event);
 	ut_free(buf_dblwr->write_buf_unaligned);
 	buf_dblwr->write_buf_unaligned = NULL;
@@ -718,6 +773,12 @@ buf_dblwr_free()
 	ut_free(buf_dblwr->buf_block_arr);
 	buf_dblwr->buf_block_arr = NULL;
 
+	ut_free(buf_dblwr->space_ids);
+	buf_dblwr->space_ids = NULL;
+
+	ut_free(buf_dblwr->s_free);
+	buf_dblwr->s_free = NULL;
+
 	ut_free(buf_dblwr->in_use);
 	buf_dblwr->in_use = NULL;
 
@@ -726,6 +787,38 @@ buf_dblwr_free()
 	buf_dblwr = NULL;
 }
 
+/** Get the batch flush shard of the doublewrite buffer for a page.
+@param[in]	buf_pool	buffer pool instance of the page
+@return the shard */
+static
+buf_dblwr_shard_t*
+buf_dblwr_get_shard(const buf_pool_t* buf_pool)
+{
+	return(&buf_dblwr->shards[buf_pool->instance_no
+				  % buf_dblwr->n_shards]);
+}
+
+/** Sync the data files that the pages of a finished batch of a batch flush
+shard were written to. Other shards sync their own files.
+@param[in]	shard	batch flush shard */
+static
+void
+buf_dblwr_sync_shard(const buf_dblwr_shard_t* shard)
+{
+	ut_ad(shard->batch_running);
+
+	ulint*	ids = buf_dblwr->space_ids + shard->start;
+	ulint*	end = ids + shard->first_free;
+
+	std::sort(ids, end);
+	end = std::unique(ids, end);
+
+	/* It will not hurt to call fil_flush() on a dropped space. */
+	for (; ids != end; ids++) {
+		fil_flush(*ids);
+	}
+}
+
 /********************************************************************//**
 Updates the doublewrite buffer when an IO request is completed. */
 void
@@ -742,28 +835,33 @@ buf_dblwr_update(
 	switch (flush_type) {
 	case BUF_FLUSH_LIST:
 	case BUF_FLUSH_LRU:
-		mutex_enter(&buf_dblwr->mutex);
+		{
+			buf_dblwr_shard_t*	shard = buf_dblwr_get_shard(
+				buf_pool_from_bpage(bpage));
 
-		ut_ad(buf_dblwr->batch_running);
-		ut_ad(buf_dblwr->b_reserved > 0);
-		ut_ad(buf_dblwr->b_reserved <= buf_dblwr->first_free);
+			mutex_enter(&shard->mutex);
 
-		buf_dblwr->b_reserved--;
+			ut_ad(shard->batch_running);
+			ut_ad(shard->b_reserved > 0);
+			ut_ad(shard->b_reserved <= shard->first_free);
 
-		if (buf_dblwr->b_reserved == 0) {
-			mutex_exit(&buf_dblwr->mutex);
-			/* This will finish the batch. Sync data files
-			to the disk. */
-			fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
-			mutex_enter(&buf_dblwr->mutex);
+			shard->b_reserved--;
 
-			/* We can now reuse the doublewrite memory buffer: */
-			buf_dblwr->first_free = 0;
-			buf_dblwr->batch_running = false;
-			os_event_set(buf_dblwr->b_event);
-		}
+			if (shard->b_reserved == 0) {
+				mutex_exit(&shard->mutex);
+				/* This will finish the batch. Sync data files
+				to the disk. */
+				buf_dblwr_sync_shard(shard);
+				mutex_enter(&shard->mutex);
 
-		mutex_exit(&buf_dblwr->mutex);
+				/* We can now reuse the shard: */
+				shard->first_free = 0;
+				shard->batch_running = false;
+				os_event_set(shard->b_event);
+			}
+
+			mutex_exit(&shard->mutex);
+		}
 		break;
 	case BUF_FLUSH_SINGLE_PAGE:
 		{
@@ -772,6 +870,9 @@ buf_dblwr_update(
 			mutex_enter(&buf_dblwr->mutex);
 			for (i = srv_doublewrite_batch_size; i < size; ++i) {
 				if (buf_dblwr->buf_block_arr[i] == bpage) {
+					buf_dblwr->s_free[
+						size - srv_doublewrite_batch_size
+						- buf_dblwr->s_reserved] = i;
 					buf_dblwr->s_reserved--;
 					buf_dblwr->buf_block_arr[i] = NULL;
 					buf_dblwr->in_use[i] = false;
@@ -949,39 +1050,63 @@ buf_dblwr_write_block_to_datafile(
 	}
 }
 
-/********************************************************************//**
-Flushes possible buffered writes from the doublewrite memory buffer to disk,
-and also wakes up the aio thread if simulated aio is used. It is very
-important to call this function after a batch of writes has been posted,
-and also when we may have to wait for a page latch! Otherwise a deadlock
-of threads can occur. */
+/** Write the pages of a batch flush shard to the doublewrite buffer in the
+system tablespace.
+@param[in]	shard	batch flush shard
+@param[in]	n	number of pages in the batch */
+static
 void
-buf_dblwr_flush_buffered_writes()
+buf_dblwr_write_shard(const buf_dblwr_shard_t* shard, ulint n)
 {
-	byte*		write_buf;
-	ulint		first_free;
-	ulint		len;
+	ulint	i = shard->start;
+	ulint	end = shard->start + n;
 
-	if (!srv_use_doublewrite_buf || buf_dblwr == NULL) {
-		/* Sync the writes to the disk. */
-		buf_dblwr_sync_datafiles();
-		/* Now we flush the data to disk (for example, with fsync) */
-		fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
-		return;
+	/* The slots of a shard are contiguous, but they may be split
+	between the two doublewrite blocks. */
+	if (i < TRX_SYS_DOUBLEWRITE_BLOCK_SIZE) {
+		ulint	n1 = std::min<ulint>(
+			TRX_SYS_DOUBLEWRITE_BLOCK_SIZE, end) - i;
+
+		fil_io(IORequestWrite, true,
+		       page_id_t(TRX_SYS_SPACE, buf_dblwr->block1 + i), 0,
+		       0, n1 << srv_page_size_shift,
+		       (void*) (buf_dblwr->write_buf
+				+ (i << srv_page_size_shift)),
+		       NULL);
+
+		i += n1;
 	}
 
-	ut_ad(!srv_read_only_mode);
+	if (i < end) {
+		fil_io(IORequestWrite, true,
+		       page_id_t(TRX_SYS_SPACE, buf_dblwr->block2 + i
+				 - TRX_SYS_DOUBLEWRITE_BLOCK_SIZE), 0,
+		       0, (end - i) << srv_page_size_shift,
+		       (void*) (buf_dblwr->write_buf
+				+ (i << srv_page_size_shift)),
+		       NULL);
+	}
+}
+
+/** Flush possible buffered writes of a batch flush shard of the doublewrite
+buffer to disk, and post the writes to the data files.
+@param[in,out]	shard	batch flush shard */
+static
+void
+buf_dblwr_flush_shard(buf_dblwr_shard_t* shard)
+{
+	ulint		first_free;
 
 try_again:
-	mutex_enter(&buf_dblwr->mutex);
+	mutex_enter(&shard->mutex);
 
 	/* Write first to doublewrite buffer blocks. We use synchronous
 	aio and thus know that file write has been completed when the
 	control returns. */
 
-	if (buf_dblwr->first_free == 0) {
+	if (shard->first_free == 0) {
 
-		mutex_exit(&buf_dblwr->mutex);
+		mutex_exit(&shard->mutex);
 
 		/* Wake possible simulated aio thread as there could be
 		system temporary tablespace pages active for flushing.
@@ -992,38 +1117,40 @@ buf_dblwr_flush_buffered_writes()
 		return;
 	}
 
-	if (buf_dblwr->batch_running) {
+	if (shard->batch_running) {
 		/* Another thread is running the batch right now. Wait
 		for it to finish. */
-		int64_t	sig_count = os_event_reset(buf_dblwr->b_event);
-		mutex_exit(&buf_dblwr->mutex);
+		int64_t	sig_count = os_event_reset(shard->b_event);
+		mutex_exit(&shard->mutex);
 
-		os_event_wait_low(buf_dblwr->b_event, sig_count);
+		os_event_wait_low(shard->b_event, sig_count);
 		goto try_again;
 	}
 
-	ut_ad(buf_dblwr->first_free == buf_dblwr->b_reserved);
+	ut_ad(shard->first_free == shard->b_reserved);
 
-	/* Disallow anyone else to post to doublewrite buffer or to
-	start another batch of flushing. */
-	buf_dblwr->batch_running = true;
-	first_free = buf_dblwr->first_free;
+	/* Disallow anyone else to post to the shard or to start
+	another batch of flushing from it. */
+	shard->batch_running = true;
+	first_free = shard->first_free;
 
 	/* Now safe to release the mutex. Note that though no other
-	thread is allowed to post to the doublewrite batch flushing
-	but any threads working on single page flushes are allowed
-	to proceed. */
-	mutex_exit(&buf_dblwr->mutex);
+	thread is allowed to post to this shard, other shards and any
+	threads working on single page flushes are allowed to proceed. */
+	mutex_exit(&shard->mutex);
 
-	write_buf = buf_dblwr->write_buf;
+	buf_page_t** const	buf_block_arr
+		= buf_dblwr->buf_block_arr + shard->start;
+	const byte*		write_buf = buf_dblwr->write_buf
+		+ (shard->start << srv_page_size_shift);
 
 	for (ulint len2 = 0, i = 0;
-	     i < buf_dblwr->first_free;
+	     i < first_free;
 	     len2 += srv_page_size, i++) {
 
 		const buf_block_t*	block;
 
-		block = (buf_block_t*) buf_dblwr->buf_block_arr[i];
+		block = (buf_block_t*) buf_block_arr[i];
 
 		if (buf_block_get_state(block) != BUF_BLOCK_FILE_PAGE
 		    || block->page.zip.data) {
@@ -1038,33 +1165,10 @@ buf_dblwr_flush_buffered_writes()
 		ut_d(buf_dblwr_check_page_lsn(block->page, write_buf + len2));
 	}
 
-	/* Write out the first block of the doublewrite buffer */
-	len = std::min<ulint>(TRX_SYS_DOUBLEWRITE_BLOCK_SIZE,
-			      buf_dblwr->first_free) << srv_page_size_shift;
+	buf_dblwr_write_shard(shard, first_free);
 
-	fil_io(IORequestWrite, true,
-	       page_id_t(TRX_SYS_SPACE, buf_dblwr->block1), 0,
-	       0, len, (void*) write_buf, NULL);
-
-	if (buf_dblwr->first_free <= TRX_SYS_DOUBLEWRITE_BLOCK_SIZE) {
-		/* No unwritten pages in the second block. */
-		goto flush;
-	}
-
-	/* Write out the second block of the doublewrite buffer. */
-	len = (buf_dblwr->first_free - TRX_SYS_DOUBLEWRITE_BLOCK_SIZE)
-	       << srv_page_size_shift;
-
-	write_buf = buf_dblwr->write_buf
-		+ (TRX_SYS_DOUBLEWRITE_BLOCK_SIZE << srv_page_size_shift);
-
-	fil_io(IORequestWrite, true,
-	       page_id_t(TRX_SYS_SPACE, buf_dblwr->block2), 0,
-	       0, len, (void*) write_buf, NULL);
-
-flush:
 	/* increment the doublewrite flushed pages counter */
-	srv_stats.dblwr_pages_written.add(buf_dblwr->first_free);
+	srv_stats.dblwr_pages_written.add(first_free);
 	srv_stats.dblwr_writes.inc();
 
 	/* Now flush the doublewrite buffer data to disk */
@@ -1074,21 +1178,23 @@ buf_dblwr_flush_buffered_writes()
 	and in recovery we will find them in the doublewrite buffer
 	blocks. Next do the writes to the intended positions. */
 
-	/* Up to this point first_free and buf_dblwr->first_free are
-	same because we have set the buf_dblwr->batch_running flag
+	DBUG_EXECUTE_IF("ib_dblwr_crash_before_batch_write",
+			DBUG_SUICIDE(););
+
+	/* Up to this point first_free and shard->first_free are
+	same because we have set the shard->batch_running flag
 	disallowing any other thread to post any request but we
-	can't safely access buf_dblwr->first_free in the loop below.
+	can't safely access shard->first_free in the loop below.
 	This is so because it is possible that after we are done with
 	the last iteration and before we terminate the loop, the batch
 	gets finished in the IO helper thread and another thread posts
-	a new batch setting buf_dblwr->first_free to a higher value.
-	If this happens and we are using buf_dblwr->first_free in the
+	a new batch setting shard->first_free to a higher value.
+	If this happens and we are using shard->first_free in the
 	loop termination condition then we'll end up dispatching
 	the same block twice from two different threads. */
-	ut_ad(first_free == buf_dblwr->first_free);
+	ut_ad(first_free == shard->first_free);
 	for (ulint i = 0; i < first_free; i++) {
-		buf_dblwr_write_block_to_datafile(
-			buf_dblwr->buf_block_arr[i], false);
+		buf_dblwr_write_block_to_datafile(buf_block_arr[i], false);
 	}
 
 	/* Wake possible simulated aio thread to actually post the
@@ -1098,6 +1204,36 @@ buf_dblwr_flush_buffered_writes()
 	os_aio_simulated_wake_handler_threads();
 }
 
+/** Flushes possible buffered writes from the doublewrite memory buffer to
+disk, and also wakes up the aio thread if simulated aio is used. It is very
+important to call this function after a batch of writes has been posted,
+and also when we may have to wait for a page latch! Otherwise a deadlock
+of threads can occur.
+@param[in]	buf_pool	buffer pool instance whose batch to flush,
+				or NULL to flush the batches of all instances */
+void
+buf_dblwr_flush_buffered_writes(const buf_pool_t* buf_pool)
+{
+	if (!srv_use_doublewrite_buf || buf_dblwr == NULL) {
+		/* Sync the writes to the disk. */
+		buf_dblwr_sync_datafiles();
+		/* Now we flush the data to disk (for example, with fsync) */
+		fil_flush_file_spaces(FIL_TYPE_TABLESPACE);
+		return;
+	}
+
+	ut_ad(!srv_read_only_mode);
+
+	if (buf_pool) {
+		buf_dblwr_flush_shard(buf_dblwr_get_shard(buf_pool));
+		return;
+	}
+
+	for (ulint i = 0; i < buf_dblwr->n_shards; i++) {
+		buf_dblwr_flush_shard(&buf_dblwr->shards[i]);
+	}
+}
+
 /********************************************************************//**
 Posts a buffer page for writing. If the doublewrite memory buffer is
 full, calls buf_dblwr_flush_buffered_writes and waits for for free
@@ -1109,12 +1245,15 @@ buf_dblwr_add_to_batch(
 {
 	ut_a(buf_page_in_file(bpage));
 
+	const buf_pool_t*	buf_pool = buf_pool_from_bpage(bpage);
+	buf_dblwr_shard_t*	shard = buf_dblwr_get_shard(buf_pool);
+
 try_again:
-	mutex_enter(&buf_dblwr->mutex);
+	mutex_enter(&shard->mutex);
 
-	ut_a(buf_dblwr->first_free <= srv_doublewrite_batch_size);
+	ut_a(shard->first_free <= shard->size);
 
-	if (buf_dblwr->batch_running) {
+	if (shard->batch_running) {
 
 		/* This not nearly as bad as it looks. There is only
 		page_cleaner thread which does background flushing
@@ -1122,23 +1261,23 @@ buf_dblwr_add_to_batch(
 		point. The only exception is when a user thread is
 		forced to do a flush batch because of a sync
 		checkpoint. */
-		int64_t	sig_count = os_event_reset(buf_dblwr->b_event);
-		mutex_exit(&buf_dblwr->mutex);
+		int64_t	sig_count = os_event_reset(shard->b_event);
+		mutex_exit(&shard->mutex);
 
-		os_event_wait_low(buf_dblwr->b_event, sig_count);
+		os_event_wait_low(shard->b_event, sig_count);
 		goto try_again;
 	}
 
-	if (buf_dblwr->first_free == srv_doublewrite_batch_size) {
-		mutex_exit(&(buf_dblwr->mutex));
+	if (shard->first_free == shard->size) {
+		mutex_exit(&shard->mutex);
 
-		buf_dblwr_flush_buffered_writes();
+		buf_dblwr_flush_buffered_writes(buf_pool);
 
 		goto try_again;
 	}
 
 	byte*	p = buf_dblwr->write_buf
-		+ srv_page_size * buf_dblwr->first_free;
+		+ srv_page_size * (shard->start + shard->first_free);
 
 	/* We request frame here to get correct buffer in case of
 	encryption and/or page compression */
@@ -1156,24 +1295,26 @@ buf_dblwr_add_to_batch(
 		memcpy(p, frame, srv_page_size);
 	}
 
-	buf_dblwr->buf_block_arr[buf_dblwr->first_free] = bpage;
+	buf_dblwr->buf_block_arr[shard->start + shard->first_free] = bpage;
+	buf_dblwr->space_ids[shard->start + shard->first_free]
+		= bpage->id.space();
 
-	buf_dblwr->first_free++;
-	buf_dblwr->b_reserved++;
+	shard->first_free++;
+	shard->b_reserved++;
 
-	ut_ad(!buf_dblwr->batch_running);
-	ut_ad(buf_dblwr->first_free == buf_dblwr->b_reserved);
-	ut_ad(buf_dblwr->b_reserved <= srv_doublewrite_batch_size);
+	ut_ad(!shard->batch_running);
+	ut_ad(shard->first_free == shard->b_reserved);
+	ut_ad(shard->b_reserved <= shard->size);
 
-	if (buf_dblwr->first_free == srv_doublewrite_batch_size) {
-		mutex_exit(&(buf_dblwr->mutex));
+	if (shard->first_free == shard->size) {
+		mutex_exit(&shard->mutex);
 
-		buf_dblwr_flush_buffered_writes();
+		buf_dblwr_flush_buffered_writes(buf_pool);
 
 		return;
 	}
 
-	mutex_exit(&(buf_dblwr->mutex));
+	mutex_exit(&shard->mutex);
 }
 
 /********************************************************************//**
@@ -1232,17 +1373,13 @@ buf_dblwr_write_single_page(
 		goto retry;
 	}
 
-	for (i = srv_doublewrite_batch_size; i < size; ++i) {
-
-		if (!buf_dblwr->in_use[i]) {
-			break;
-		}
-	}
-
 	/* We are guaranteed to find a slot. */
+	buf_dblwr->s_reserved++;
+	i = buf_dblwr->s_free[n_slots - buf_dblwr->s_reserved];
+	ut_a(i >= srv_doublewrite_batch_size);
 	ut_a(i < size);
+	ut_a(!buf_dblwr->in_use[i]);
 	buf_dblwr->in_use[i] = true;
-	buf_dblwr->s_reserved++;
 	buf_dblwr->buf_block_arr[i] = bpage;
 
 	/* increment the doublewrite flushed pages counter */
@@ -139,6 +139,10 @@ struct page_cleaner_slot_t {
 	ulint			flush_list_pass;
 					/*!< count to attempt flush_list
 					flushing */
+	ulint			next_flush_time;
+					/*!< ut_time_ms() at which the slot
+					is due to be flushed again when
+					page_cleaner_t::independent holds */
 };
 
 /** Page cleaner structure common for all threads */
@@ -175,6 +179,20 @@ struct page_cleaner_t {
 						requests for all slots */
 	ulint			flush_pass;	/*!< count to finish to flush
 						requests for all slots */
+	bool			independent;	/*!< true if the slots are
+						flushed independently of each
+						other, without a common round
+						(innodb_page_cleaner_independent) */
+	ulint			n_flushed_lru_independent;
+						/*!< number of pages flushed
+						from the LRU tail by
+						independent flushing since the
+						coordinator last looked */
+	ulint			n_flushed_list_independent;
+						/*!< number of pages flushed
+						from flush_list by independent
+						flushing since the coordinator
+						last looked */
 	page_cleaner_slot_t	slots[MAX_BUFFER_POOLS];
 	bool			is_running;	/*!< false if attempt
 						to shutdown */
@@ -198,6 +216,12 @@ the blocks on free list. If LRU list is very small then we can end up
 in thrashing. */
 #define BUF_LRU_MIN_LEN		256
 
+/** In the independent flushing mode, a buffer pool instance whose free
+list is still shorter than innodb_LRU_scan_depth after a flush is flushed
+again after this many milliseconds, instead of waiting for the next
+round of the coordinator. */
+#define PAGE_CLEANER_RETRY_MS	100
+
 /* @} */
 
 /******************************************************************//**
@@ -1930,7 +1954,7 @@ buf_flush_end(
 	buf_pool_mutex_exit(buf_pool);
 
 	if (!srv_read_only_mode) {
-		buf_dblwr_flush_buffered_writes();
+		buf_dblwr_flush_buffered_writes(buf_pool);
 	} else {
 		os_aio_simulated_wake_handler_threads();
 	}
@@ -2559,7 +2583,8 @@ page_cleaner_flush_pages_recommendation(
 		sum_pages_for_lsn += pages_for_lsn;
 
 		mutex_enter(&page_cleaner.mutex);
-		ut_ad(page_cleaner.slots[i].state
+		ut_ad(page_cleaner.independent
+		      || page_cleaner.slots[i].state
 		      == PAGE_CLEANER_STATE_NONE);
 		page_cleaner.slots[i].n_pages_requested
 			= pages_for_lsn / buf_flush_lsn_scan_factor + 1;
@@ -2585,7 +2610,7 @@ page_cleaner_flush_pages_recommendation(
 	/* Normalize request for each instance */
 	mutex_enter(&page_cleaner.mutex);
 	ut_ad(page_cleaner.n_slots_requested == 0);
-	ut_ad(page_cleaner.n_slots_flushing == 0);
+	ut_ad(page_cleaner.independent || page_cleaner.n_slots_flushing == 0);
 	ut_ad(page_cleaner.n_slots_finished == 0);
 
 	for (ulint i = 0; i < srv_buf_pool_instances; i++) {
@@ -2694,6 +2719,19 @@ pc_request(
 
 	mutex_enter(&page_cleaner.mutex);
 
+	/* Let any independent flushing finish before starting a round
+	that covers all slots. */
+	page_cleaner.independent = false;
+
+	while (page_cleaner.n_slots_flushing) {
+		int64_t	sig_count = os_event_reset(page_cleaner.is_finished);
+		mutex_exit(&page_cleaner.mutex);
+		os_event_wait_low(page_cleaner.is_finished, sig_count);
+		mutex_enter(&page_cleaner.mutex);
+	}
+
+	os_event_reset(page_cleaner.is_finished);
+
 	ut_ad(page_cleaner.n_slots_requested == 0);
 	ut_ad(page_cleaner.n_slots_flushing == 0);
 	ut_ad(page_cleaner.n_slots_finished == 0);
@@ -2727,6 +2765,28 @@ pc_request(
 	mutex_exit(&page_cleaner.mutex);
 }
 
+/** Account a page cleaner pass over a buffer pool instance in the
+counters of INFORMATION_SCHEMA.INNODB_BUFFER_POOL_STATS.
+@param[in,out]	buf_pool	buffer pool instance
+@param[in]	n_flushed_lru	number of pages flushed from the LRU tail
+@param[in]	n_flushed_list	number of pages flushed from flush_list
+@param[in]	tm		milliseconds spent on the pass */
+static
+void
+pc_account(
+	buf_pool_t*	buf_pool,
+	ulint		n_flushed_lru,
+	ulint		n_flushed_list,
+	ulint		tm)
+{
+	ut_ad(mutex_own(&page_cleaner.mutex));
+
+	buf_pool->stat.n_pc_passes++;
+	buf_pool->stat.n_pc_flushed_lru += n_flushed_lru;
+	buf_pool->stat.n_pc_flushed_list += n_flushed_list;
+	buf_pool->stat.pc_flush_time += tm;
+}
+
 /**
 Do flush for one slot.
 @return	the number of the slots which has not been treated yet. */
@@ -2742,7 +2802,12 @@ pc_flush_slot(void)
 	mutex_enter(&page_cleaner.mutex);
 
 	if (!page_cleaner.n_slots_requested) {
-		os_event_reset(page_cleaner.is_requested);
+		/* In the independent mode, the worker threads reset
+		is_requested themselves before they look for due slots;
+		resetting it here would make the others miss the wakeup. */
+		if (!page_cleaner.independent) {
+			os_event_reset(page_cleaner.is_requested);
+		}
 	} else {
 		page_cleaner_slot_t*	slot = NULL;
 		ulint			i;
@@ -2822,6 +2887,11 @@ pc_flush_slot(void)
 		slot->flush_lru_pass += lru_pass;
 		slot->flush_list_pass += list_pass;
 
+		if (lru_pass) {
+			pc_account(buf_pool, slot->n_flushed_lru,
+				   slot->n_flushed_list, lru_tm + list_tm);
+		}
+
 		if (page_cleaner.n_slots_requested == 0
 		    && page_cleaner.n_slots_flushing == 0) {
 			os_event_set(page_cleaner.is_finished);
@@ -2883,6 +2953,175 @@ pc_wait_finished(
 	return(all_succeeded);
 }
 
+/**
+Make all idle slots due for independent flushing, and wake up the
+worker threads. Unlike pc_request(), this does not wait for any slot
+that is still being flushed; such a slot will pick up its new
+n_pages_requested as soon as it is finished. */
+static
+void
+pc_request_independent()
+{
+	ulint	cur_time = ut_time_ms();
+
+	mutex_enter(&page_cleaner.mutex);
+
+	ut_ad(page_cleaner.n_slots_requested == 0);
+	ut_ad(page_cleaner.n_slots_finished == 0);
+
+	page_cleaner.independent = true;
+
+	for (ulint i = 0; i < page_cleaner.n_slots; i++) {
+		page_cleaner_slot_t* slot = &page_cleaner.slots[i];
+
+		if (slot->state == PAGE_CLEANER_STATE_NONE) {
+			slot->next_flush_time = cur_time;
+		}
+	}
+
+	os_event_set(page_cleaner.is_requested);
+
+	mutex_exit(&page_cleaner.mutex);
+}
+
+/**
+Flush one buffer pool instance that is due in the independent mode.
+The LRU tail and up to n_pages_requested pages of the flush_list of the
+instance are flushed, and the next flush of the instance is scheduled
+according to how far behind it is.
+@return	the number of the slots which are still due */
+static
+ulint
+pc_flush_slot_independent()
+{
+	page_cleaner_slot_t*	slot = NULL;
+	ulint			cur_time = ut_time_ms();
+	ulint			i;
+	ulint			ret = 0;
+
+	mutex_enter(&page_cleaner.mutex);
+
+	if (!page_cleaner.independent || !page_cleaner.is_running) {
+		mutex_exit(&page_cleaner.mutex);
+		return(0);
+	}
+
+	for (i = 0; i < page_cleaner.n_slots; i++) {
+		slot = &page_cleaner.slots[i];
+
+		if (slot->state == PAGE_CLEANER_STATE_NONE
+		    && slot->next_flush_time <= cur_time) {
+			break;
+		}
+	}
+
+	if (i == page_cleaner.n_slots) {
+		mutex_exit(&page_cleaner.mutex);
+		return(0);
+	}
+
+	buf_pool_t*	buf_pool = buf_pool_from_array(i);
+	ulint		n_pages = slot->n_pages_requested;
+
+	slot->n_pages_requested = 0;
+	slot->state = PAGE_CLEANER_STATE_FLUSHING;
+	page_cleaner.n_slots_flushing++;
+
+	mutex_exit(&page_cleaner.mutex);
+
+	ulint	lru_tm = ut_time_ms();
+
+	/* Flush pages from end of LRU if required */
+	ulint	n_flushed_lru = buf_flush_LRU_list(buf_pool);
+
+	lru_tm = ut_time_ms() - lru_tm;
+
+	ulint	list_tm = 0;
+	ulint	n_flushed_list = 0;
+
+	/* Flush pages from flush_list if required */
+	if (n_pages > 0) {
+		flush_counters_t n;
+		memset(&n, 0, sizeof(flush_counters_t));
+		list_tm = ut_time_ms();
+
+		buf_flush_do_batch(buf_pool, BUF_FLUSH_LIST, n_pages,
+				   LSN_MAX, &n);
+
+		n_flushed_list = n.flushed;
+		list_tm = ut_time_ms() - list_tm;
+	}
+
+	cur_time = ut_time_ms();
+
+	mutex_enter(&page_cleaner.mutex);
+
+	slot->state = PAGE_CLEANER_STATE_NONE;
+	slot->flush_lru_time += lru_tm;
+	slot->flush_lru_pass++;
+
+	if (n_pages > 0) {
+		slot->flush_list_time += list_tm;
+		slot->flush_list_pass++;
+	}
+
+	page_cleaner.n_flushed_lru_independent += n_flushed_lru;
+	page_cleaner.n_flushed_list_independent += n_flushed_list;
+
+	pc_account(buf_pool, n_flushed_lru, n_flushed_list, lru_tm + list_tm);
+
+	if (slot->n_pages_requested > 0) {
+		/* The coordinator handed out a new target while we
+		were flushing: this instance is falling behind. */
+		slot->next_flush_time = cur_time;
+	} else if (UT_LIST_GET_LEN(buf_pool->free) < srv_LRU_scan_depth) {
+		slot->next_flush_time = cur_time + PAGE_CLEANER_RETRY_MS;
+	} else {
+		/* Wait for the next round of the coordinator. */
+		slot->next_flush_time = ULINT_MAX;
+	}
+
+	if (--page_cleaner.n_slots_flushing == 0) {
+		os_event_set(page_cleaner.is_finished);
+	}
+
+	for (i = 0; i < page_cleaner.n_slots; i++) {
+		slot = &page_cleaner.slots[i];
+
+		if (slot->state == PAGE_CLEANER_STATE_NONE
+		    && slot->next_flush_time <= cur_time) {
+			ret++;
+		}
+	}
+
+	mutex_exit(&page_cleaner.mutex);
+
+	return(ret);
+}
+
+/**
+Collect the number of pages flushed by independent flushing since
+the previous call.
+@param n_flushed_lru	number of pages flushed from the end of the LRU list.
+@param n_flushed_list	number of pages flushed from the end of the
+			flush_list. */
+static
+void
+pc_collect_independent(
+	ulint*	n_flushed_lru,
+	ulint*	n_flushed_list)
+{
+	mutex_enter(&page_cleaner.mutex);
+
+	*n_flushed_lru = page_cleaner.n_flushed_lru_independent;
+	*n_flushed_list = page_cleaner.n_flushed_list_independent;
+
+	page_cleaner.n_flushed_lru_independent = 0;
+	page_cleaner.n_flushed_list_independent = 0;
+
+	mutex_exit(&page_cleaner.mutex);
+}
+
 #ifdef UNIV_LINUX
 /**
 Set priority for page_cleaner threads.
@@ -3203,26 +3442,46 @@ DECLARE_THREAD(buf_flush_page_cleaner_coordinator)(void*)
 				n_to_flush = 0;
 			}
 
-			/* Request flushing for threads */
-			pc_request(n_to_flush, lsn_limit);
+			ulint	n_flushed_lru = 0;
+			ulint	n_flushed_list = 0;
 
-			ulint tm = ut_time_ms();
+			if (srv_page_cleaner_independent) {
+				/* Let each slot be flushed on its own,
+				without waiting for the slowest one. */
+				pc_request_independent();
 
-			/* Coordinator also treats requests */
-			while (pc_flush_slot() > 0) {
-				/* No op */
-			}
+				ulint tm = ut_time_ms();
 
-			/* only coordinator is using these counters,
-			so no need to protect by lock. */
-			page_cleaner.flush_time += ut_time_ms() - tm;
-			page_cleaner.flush_pass++ ;
+				/* Coordinator also treats due slots */
+				while (pc_flush_slot_independent() > 0) {
+					/* No op */
+				}
 
-			/* Wait for all slots to be finished */
-			ulint	n_flushed_lru = 0;
-			ulint	n_flushed_list = 0;
+				page_cleaner.flush_time += ut_time_ms() - tm;
+				page_cleaner.flush_pass++;
 
-			pc_wait_finished(&n_flushed_lru, &n_flushed_list);
+				pc_collect_independent(&n_flushed_lru,
+						       &n_flushed_list);
+			} else {
+				/* Request flushing for threads */
+				pc_request(n_to_flush, lsn_limit);
+
+				ulint tm = ut_time_ms();
+
+				/* Coordinator also treats requests */
+				while (pc_flush_slot() > 0) {
+					/* No op */
+				}
+
+				/* only coordinator is using these counters,
+				so no need to protect by lock. */
+				page_cleaner.flush_time += ut_time_ms() - tm;
+				page_cleaner.flush_pass++ ;
+
+				/* Wait for all slots to be finished */
+				pc_wait_finished(&n_flushed_lru,
+						 &n_flushed_list);
+			}
 
 			if (n_flushed_list > 0 || n_flushed_lru > 0) {
 				buf_flush_stats(n_flushed_list, n_flushed_lru);
@@ -3452,8 +3711,17 @@ DECLARE_THREAD(buf_flush_page_cleaner_worker)(
 	}
 #endif /* UNIV_LINUX */
 
+	int64_t	sig_count = 0;
+
 	while (true) {
-		os_event_wait(page_cleaner.is_requested);
+		if (page_cleaner.independent) {
+			/* Slots may become due without a request. */
+			os_event_wait_time_low(page_cleaner.is_requested,
+					       PAGE_CLEANER_RETRY_MS * 1000,
+					       sig_count);
+		} else {
+			os_event_wait(page_cleaner.is_requested);
+		}
 
 		ut_d(buf_flush_page_cleaner_disabled_loop());
 
@@ -3475,7 +3743,14 @@ DECLARE_THREAD(buf_flush_page_cleaner_worker)(
 			break;
 		}
 
+		/* Reset the event before looking for work, so that a
+		request made while we are flushing wakes us up again. */
+		sig_count = page_cleaner.independent
+			? os_event_reset(page_cleaner.is_requested) : 0;
+
 		pc_flush_slot();
+
+		while (pc_flush_slot_independent() > 0) {}
 	}
 
 	mutex_enter(&page_cleaner.mutex);
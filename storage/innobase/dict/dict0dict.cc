@@ -1934,6 +1934,41 @@ bool dict_index_t::rec_potentially_too_big(bool strict) const
 	return false;
 }
 
+/** Compute dict_index_t::fixed_offsets.
+@param[in,out]	index	index that is being added to the cache */
+static
+void
+dict_index_init_fixed_offsets(dict_index_t* index)
+{
+	ut_ad(!index->fixed_offsets);
+
+	if (!dict_table_is_comp(index->table)
+	    || index->n_nullable
+	    || (index->type & (DICT_FTS | DICT_SPATIAL | DICT_IBUF))) {
+		return;
+	}
+
+	for (ulint i = 0; i < index->n_fields; i++) {
+		if (!index->fields[i].fixed_len) {
+			return;
+		}
+	}
+
+	ulint*	offs = static_cast<ulint*>(
+		mem_heap_alloc(index->heap,
+			       (1 + index->n_fields) * sizeof *offs));
+	ulint	end = 0;
+
+	offs[0] = REC_N_NEW_EXTRA_BYTES | REC_OFFS_COMPACT;
+
+	for (ulint i = 0; i < index->n_fields; i++) {
+		end += index->fields[i].fixed_len;
+		offs[i + 1] = end;
+	}
+
+	index->fixed_offsets = offs;
+}
+
 /** Adds an index to the dictionary cache, with possible indexing newly
 added column.
 @param[in]	index	index; NOTE! The index memory
@@ -2083,6 +2118,7 @@ dict_index_add_to_cache(
 		       SYNC_INDEX_TREE);
 
 	new_index->n_core_fields = new_index->n_fields;
+	dict_index_init_fixed_offsets(new_index);
 
 	dict_mem_index_free(index);
 	if (err) *err = DB_SUCCESS;
@@ -55,6 +55,17 @@ ib_create(
 	ut_ad(ut_is_2pow(n_sync_obj));
 	table = hash_create(n);
 
+#ifdef BTR_CUR_HASH_ADAPT
+	if (type == MEM_HEAP_FOR_BTR_SEARCH) {
+		table->seq = static_cast<std::atomic<ulint>*>(
+			ut_malloc_nokey(HA_SEQ_STRIPES * sizeof *table->seq));
+
+		for (ulint i = 0; i < HA_SEQ_STRIPES; i++) {
+			new (&table->seq[i]) std::atomic<ulint>(0);
+		}
+	}
+#endif /* BTR_CUR_HASH_ADAPT */
+
 	/* Creating MEM_HEAP_BTR_SEARCH type heaps can potentially fail,
 	but in practise it never should in this case, hence the asserts. */
 
@@ -251,7 +262,9 @@ ha_insert_for_fold_func(
 
 			prev_node->block = block;
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
+			ha_modify_begin(table, fold);
 			prev_node->data = data;
+			ha_modify_end(table, fold);
 
 			return(TRUE);
 		}
@@ -261,18 +274,33 @@ ha_insert_for_fold_func(
 
 	/* We have to allocate a new chain node */
 
-	node = static_cast<ha_node_t*>(
-		mem_heap_alloc(hash_get_heap(table, fold), sizeof(ha_node_t)));
+	if (table->free_nodes) {
+		node = table->free_nodes;
+		table->free_nodes = node->next;
+	} else {
+		node = static_cast<ha_node_t*>(
+			mem_heap_alloc(hash_get_heap(table, fold),
+				       sizeof(ha_node_t)));
 
-	if (node == NULL) {
-		/* It was a btr search type memory heap and at the moment
-		no more memory could be allocated: return */
+		if (node == NULL) {
+			/* It was a btr search type memory heap and at
+			the moment no more memory could be allocated:
+			return */
 
-		ut_ad(hash_get_heap(table, fold)->type & MEM_HEAP_BTR_SEARCH);
+			ut_ad(hash_get_heap(table, fold)->type
+			      & MEM_HEAP_BTR_SEARCH);
 
-		return(FALSE);
+			return(FALSE);
+		}
 	}
 
+	/* A reused node may still be read by a lookup without the
+	latch that reached it through its previous chain. Start the
+	modification before overwriting it; that lookup is invalidated
+	by the counter of the previous chain, which ha_delete_hash_node()
+	incremented before the node could be reused. */
+	ha_modify_begin(table, fold);
+
 	ha_node_set_data(node, block, data);
 
 #if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
@@ -290,16 +318,16 @@ ha_insert_for_fold_func(
 	if (prev_node == NULL) {
 
 		cell->node = node;
+	} else {
+		while (prev_node->next != NULL) {
 
-		return(TRUE);
-	}
-
-	while (prev_node->next != NULL) {
+			prev_node = prev_node->next;
+		}
 
-		prev_node = prev_node->next;
+		prev_node->next = node;
 	}
 
-	prev_node->next = node;
+	ha_modify_end(table, fold);
 
 	return(TRUE);
 }
@@ -342,7 +370,16 @@ ha_delete_hash_node(
 	}
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
 
-	HASH_DELETE_AND_COMPACT(ha_node_t, next, table, del_node);
+	/* Do not compact the heap like HASH_DELETE_AND_COMPACT():
+	ha_search_and_get_data_optimistic() may be reading any node
+	without the latch. Keep the node for ha_insert_for_fold(). */
+	const ulint	fold = del_node->fold;
+
+	ha_modify_begin(table, fold);
+	HASH_DELETE(ha_node_t, next, table, fold, del_node);
+	del_node->next = table->free_nodes;
+	table->free_nodes = del_node;
+	ha_modify_end(table, fold);
 }
 
 /*********************************************************//**
@@ -386,7 +423,9 @@ ha_search_and_update_if_found_func(
 
 		node->block = new_block;
 #endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
+		ha_modify_begin(table, fold);
 		node->data = new_data;
+		ha_modify_end(table, fold);
 
 		return(TRUE);
 	}
@@ -421,8 +460,8 @@ ha_remove_all_nodes_to_page(
 			ha_delete_hash_node(table, node);
 
 			/* Start again from the first node in the chain
-			because the deletion may compact the heap of
-			nodes and move other nodes! */
+			because the deleted node was moved to
+			table->free_nodes! */
 
 			node = ha_chain_get_first(table, fold);
 		} else {
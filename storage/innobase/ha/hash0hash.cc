@@ -118,6 +118,8 @@ hash_create(
 # if defined UNIV_AHI_DEBUG || defined UNIV_DEBUG
 	table->adaptive = FALSE;
 # endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
+	table->seq = NULL;
+	table->free_nodes = NULL;
 #endif /* BTR_CUR_HASH_ADAPT */
 	table->n_sync_obj = 0;
 	table->sync_obj.mutexes = NULL;
@@ -140,6 +142,9 @@ hash_table_free(
 {
 	ut_ad(table->magic_n == HASH_TABLE_MAGIC_N);
 
+#ifdef BTR_CUR_HASH_ADAPT
+	ut_free(table->seq);
+#endif /* BTR_CUR_HASH_ADAPT */
 	ut_free(table->array);
 	ut_free(table);
 }
@@ -605,7 +605,6 @@ static PSI_mutex_info all_innodb_mutexes[] = {
 	PSI_KEY(trx_pool_mutex),
 	PSI_KEY(trx_pool_manager_mutex),
 	PSI_KEY(srv_sys_mutex),
-	PSI_KEY(lock_mutex),
 	PSI_KEY(lock_wait_mutex),
 	PSI_KEY(trx_mutex),
 	PSI_KEY(srv_threads_mutex),
@@ -640,6 +639,7 @@ static PSI_rwlock_info all_innodb_rwlocks[] = {
 	PSI_RWLOCK_KEY(fts_cache_init_rw_lock),
 	PSI_RWLOCK_KEY(trx_i_s_cache_lock),
 	PSI_RWLOCK_KEY(trx_purge_latch),
+	PSI_RWLOCK_KEY(lock_latch),
 	PSI_RWLOCK_KEY(index_tree_rw_lock),
 	PSI_RWLOCK_KEY(index_online_log),
 	PSI_RWLOCK_KEY(dict_table_stats),
@@ -932,6 +932,11 @@ static MYSQL_THDVAR_ULONG(lock_wait_timeout, PLUGIN_VAR_RQCMDARG,
   "Timeout in seconds an InnoDB transaction may wait for a lock before being rolled back. Values above 100000000 disable the timeout.",
   NULL, NULL, 50, 0, 1024 * 1024 * 1024, 0);
 
+static MYSQL_THDVAR_UINT(ddl_threads, PLUGIN_VAR_RQCMDARG,
+  "Number of threads that sort and load the non-unique secondary indexes"
+  " of a table in ALTER TABLE",
+  NULL, NULL, 4, 1, 64, 0);
+
 static MYSQL_THDVAR_STR(ft_user_stopword_table,
   PLUGIN_VAR_OPCMDARG|PLUGIN_VAR_MEMALLOC,
   "User supplied stopword table name, effective in the session level.",
@@ -1803,6 +1808,17 @@ thd_innodb_tmpdir(
 	return(tmp_dir);
 }
 
+/** Get the value of innodb_ddl_threads.
+@param[in]	thd	thread handle, or NULL to query
+			the global innodb_ddl_threads
+@return number of threads that sort and load secondary indexes */
+ulint
+thd_ddl_threads(
+	THD*	thd)
+{
+	return(THDVAR(thd, ddl_threads));
+}
+
 /** Obtain the InnoDB transaction of a MySQL thread.
 @param[in,out]	thd	thread handle
 @return reference to transaction pointer */
@@ -3941,6 +3957,14 @@ static int innodb_init_params()
 		srv_use_doublewrite_buf = FALSE;
 	}
 
+#ifndef HAVE_IO_URING
+	if (srv_use_io_uring) {
+		ib::warn() << "innodb_use_io_uring is not supported"
+			" on this platform";
+		srv_use_io_uring = FALSE;
+	}
+#endif /* !HAVE_IO_URING */
+
 #ifdef LINUX_NATIVE_AIO
 	if (srv_use_native_aio) {
 		ib::info() << "Using Linux native AIO";
@@ -15033,10 +15057,35 @@ ha_innobase::reset()
 
 	/* This is a statement level counter. */
 	m_prebuilt->autoinc_last_value = 0;
+	m_prebuilt->bulk_insert = false;
 
 	return(0);
 }
 
+/** Note that a statement is about to insert multiple rows.
+Each row will still be passed to write_row(), but the clustered index
+leaf page of the previous row will be tried first, instead of
+descending the tree from the root for every row. If the table is empty,
+the rows may be inserted without undo log; see row_ins_bulk_check(). */
+void
+ha_innobase::start_bulk_insert(ha_rows, uint)
+{
+	m_prebuilt->bulk_insert = true;
+
+	if (ins_node_t* node = m_prebuilt->ins_node) {
+		node->bulk = INS_BULK_UNKNOWN;
+	}
+}
+
+/** Note the end of inserting multiple rows.
+@return 0 */
+int
+ha_innobase::end_bulk_insert()
+{
+	m_prebuilt->bulk_insert = false;
+	return(0);
+}
+
 /******************************************************************//**
 MySQL calls this function at the start of each SQL statement inside LOCK
 TABLES. Inside LOCK TABLES the ::external_lock method does not work to
@@ -18481,6 +18530,13 @@ static MYSQL_SYSVAR_BOOL(doublewrite, srv_use_doublewrite_buf,
   " Disable with --skip-innodb-doublewrite.",
   NULL, NULL, TRUE);
 
+static MYSQL_SYSVAR_ULONG(doublewrite_shards, srv_doublewrite_shards,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Maximum number of parts the batch flushing area of the doublewrite"
+  " buffer is split into, so that the page cleaners of different buffer"
+  " pool instances can write their batches at the same time",
+  NULL, NULL, 1, 1, MAX_BUFFER_POOLS, 0);
+
 static MYSQL_SYSVAR_BOOL(use_atomic_writes, innobase_use_atomic_writes,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
   "Enable atomic writes, instead of using the doublewrite buffer, for files "
@@ -18641,6 +18697,14 @@ static MYSQL_SYSVAR_ULONG(page_cleaners, srv_n_page_cleaners,
   NULL,
   innodb_page_cleaners_threads_update, 4, 1, 64, 0);
 
+static MYSQL_SYSVAR_BOOL(page_cleaner_independent,
+  srv_page_cleaner_independent,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether the page cleaner threads flush each buffer pool instance"
+  " on its own adaptive schedule, instead of waiting for all instances"
+  " to finish a common round.",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_DOUBLE(max_dirty_pages_pct, srv_max_buf_pool_modified_pct,
   PLUGIN_VAR_RQCMDARG,
   "Percentage of dirty pages allowed in bufferpool.",
@@ -19071,6 +19135,11 @@ static MYSQL_SYSVAR_ULONG(write_io_threads, srv_n_write_io_threads,
   "Number of background write I/O threads in InnoDB.",
   NULL, NULL, 4, 1, 64, 0);
 
+static MYSQL_SYSVAR_UINT(recovery_threads, srv_n_recovery_threads,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Number of threads that apply the redo log to pages during crash recovery.",
+  NULL, NULL, 4, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONG(force_recovery, srv_force_recovery,
   PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
   "Helps to save your data in case the disk image of the database becomes corrupt. Value 5 can return bogus data, and 6 can permanently corrupt data.",
@@ -19229,6 +19298,12 @@ static MYSQL_SYSVAR_BOOL(use_native_aio, srv_use_native_aio,
   "Use native AIO if supported on this platform.",
   NULL, NULL, TRUE);
 
+static MYSQL_SYSVAR_BOOL(use_io_uring, srv_use_io_uring,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Use io_uring instead of libaio for native AIO on Linux"
+  " (requires innodb_use_native_aio=ON and Linux 5.11 or later).",
+  NULL, NULL, FALSE);
+
 #ifdef HAVE_LIBNUMA
 static MYSQL_SYSVAR_BOOL(numa_interleave, srv_numa_interleave,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
@@ -19646,10 +19721,12 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(temp_data_file_path),
   MYSQL_SYSVAR(data_home_dir),
   MYSQL_SYSVAR(doublewrite),
+  MYSQL_SYSVAR(doublewrite_shards),
   MYSQL_SYSVAR(stats_include_delete_marked),
   MYSQL_SYSVAR(use_atomic_writes),
   MYSQL_SYSVAR(fast_shutdown),
   MYSQL_SYSVAR(read_io_threads),
+  MYSQL_SYSVAR(recovery_threads),
   MYSQL_SYSVAR(write_io_threads),
   MYSQL_SYSVAR(file_per_table),
   MYSQL_SYSVAR(file_format), /* deprecated in MariaDB 10.2; no effect */
@@ -19672,6 +19749,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(lock_wait_timeout),
   MYSQL_SYSVAR(deadlock_detect),
   MYSQL_SYSVAR(page_size),
+  MYSQL_SYSVAR(ddl_threads),
   MYSQL_SYSVAR(log_buffer_size),
   MYSQL_SYSVAR(log_file_size),
   MYSQL_SYSVAR(log_files_in_group),
@@ -19725,6 +19803,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(autoinc_lock_mode),
   MYSQL_SYSVAR(version),
   MYSQL_SYSVAR(use_native_aio),
+  MYSQL_SYSVAR(use_io_uring),
 #ifdef HAVE_LIBNUMA
   MYSQL_SYSVAR(numa_interleave),
 #endif /* HAVE_LIBNUMA */
@@ -19742,6 +19821,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(io_capacity),
   MYSQL_SYSVAR(io_capacity_max),
   MYSQL_SYSVAR(page_cleaners),
+  MYSQL_SYSVAR(page_cleaner_independent),
   MYSQL_SYSVAR(idle_flush_pct),
   MYSQL_SYSVAR(monitor_enable),
   MYSQL_SYSVAR(monitor_disable),
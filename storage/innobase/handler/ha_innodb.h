@@ -179,6 +179,10 @@ class ha_innobase final: public handler
 
 	int reset() override;
 
+	void start_bulk_insert(ha_rows rows, uint flags) override;
+
+	int end_bulk_insert() override;
+
 	int external_lock(THD *thd, int lock_type) override;
 
 	int start_stmt(THD *thd, thr_lock_type lock_type) override;
@@ -3655,6 +3655,21 @@ static ST_FIELD_INFO	i_s_innodb_buffer_stats_fields_info[] =
 #define IDX_BUF_STATS_UNZIP_CUR		31
   Column("UNCOMPRESS_CURRENT", ULonglong(), NOT_NULL),
 
+#define IDX_BUF_STATS_OLDEST_MODIFICATION 32
+  Column("OLDEST_MODIFICATION", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_STATS_PC_PASSES		33
+  Column("PAGE_CLEANER_PASSES", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_STATS_PC_FLUSHED_LRU	34
+  Column("PAGE_CLEANER_LRU_FLUSHED", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_STATS_PC_FLUSHED_LIST	35
+  Column("PAGE_CLEANER_LIST_FLUSHED", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_STATS_PC_TIME		36
+  Column("PAGE_CLEANER_TIME", ULonglong(), NOT_NULL),
+
   CEnd()
 };
 } // namespace Show
@@ -3791,6 +3806,21 @@ i_s_innodb_stats_fill(
 	OK(fields[IDX_BUF_STATS_UNZIP_CUR]->store(
 		   info->unzip_cur, true));
 
+	OK(fields[IDX_BUF_STATS_OLDEST_MODIFICATION]->store(
+		   info->oldest_modification, true));
+
+	OK(fields[IDX_BUF_STATS_PC_PASSES]->store(
+		   info->n_pc_passes, true));
+
+	OK(fields[IDX_BUF_STATS_PC_FLUSHED_LRU]->store(
+		   info->n_pc_flushed_lru, true));
+
+	OK(fields[IDX_BUF_STATS_PC_FLUSHED_LIST]->store(
+		   info->n_pc_flushed_list, true));
+
+	OK(fields[IDX_BUF_STATS_PC_TIME]->store(
+		   info->pc_flush_time, true));
+
 	DBUG_RETURN(schema_table_store_record(thd, table));
 }
 
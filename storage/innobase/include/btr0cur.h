@@ -56,7 +56,12 @@ enum {
 	/** the caller of btr_cur_optimistic_update() or
 	btr_cur_update_in_place() will take care of
 	updating IBUF_BITMAP_FREE */
-	BTR_KEEP_IBUF_BITMAP = 32
+	BTR_KEEP_IBUF_BITMAP = 32,
+	/** with BTR_NO_UNDO_LOG_FLAG: the transaction is loading an
+	empty table that it has locked exclusively, and it has written a
+	TRX_UNDO_EMPTY undo log record instead of one for each row
+	(row_ins_bulk_check()); DB_TRX_ID is that of the transaction */
+	BTR_BULK_INSERT_FLAG = 64
 };
 
 /* btr_cur_latch_leaves() returns latched blocks and savepoints. */
@@ -169,6 +174,26 @@ btr_cur_optimistic_latch_leaves(
 	unsigned	line,
 	mtr_t*		mtr);
 
+/** Position a tree cursor on a guessed leaf page for inserting a tuple,
+without descending from the root. This succeeds if the page has not
+been modified by anything else than inserts since the guess was made,
+and the tuple falls inside the page, so that the search from the root
+would end on the page as well.
+@param[in]	index	B-tree index
+@param[in]	tuple	tuple to be inserted
+@param[in]	guess	guessed leaf page
+@param[out]	cursor	cursor positioned as with PAGE_CUR_LE
+@param[in,out]	mtr	mini-transaction
+@return whether the cursor was positioned on an X-latched page */
+bool
+btr_cur_search_leaf_guess(
+	dict_index_t*		index,
+	const dtuple_t*		tuple,
+	const btr_leaf_guess_t&	guess,
+	btr_cur_t*		cursor,
+	mtr_t*			mtr)
+	MY_ATTRIBUTE((nonnull, warn_unused_result));
+
 /********************************************************************//**
 Searches an index tree and positions a tree cursor on a given level.
 NOTE: n_fields_cmp in tuple must be set so that it cannot be compared
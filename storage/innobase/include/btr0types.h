@@ -29,6 +29,7 @@ Created 2/17/1996 Heikki Tuuri
 
 #include "page0types.h"
 #include "rem0types.h"
+#include "buf0types.h"
 
 /** Persistent cursor */
 struct btr_pcur_t;
@@ -37,6 +38,16 @@ struct btr_cur_t;
 /** B-tree search information for the adaptive hash index */
 struct btr_search_t;
 
+/** A guess of the leaf page that a search would end on */
+struct btr_leaf_guess_t {
+	/** the guessed leaf page, or NULL */
+	buf_block_t*	block;
+	/** block->modify_clock when the guess was made */
+	ib_uint64_t	modify_clock;
+	/** buf_withdraw_clock when the guess was made */
+	ulint		withdraw_clock;
+};
+
 #ifdef BTR_CUR_HASH_ADAPT
 /** Is search system enabled.
 Search system is protected by array of latches. */
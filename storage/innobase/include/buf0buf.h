@@ -193,6 +193,14 @@ struct buf_pool_info_t{
 	ulint	unzip_cur;		/*!< buf_LRU_stat_cur.unzip, num
 					pages decompressed in current
 					interval */
+
+	/* Page cleaner activity */
+	lsn_t	oldest_modification;	/*!< oldest_modification of the
+					oldest page in flush_list, or 0 */
+	ulint	n_pc_passes;		/*!< buf_pool->stat.n_pc_passes */
+	ulint	n_pc_flushed_lru;	/*!< buf_pool->stat.n_pc_flushed_lru */
+	ulint	n_pc_flushed_list;	/*!< buf_pool->stat.n_pc_flushed_list */
+	ulint	pc_flush_time;		/*!< buf_pool->stat.pc_flush_time */
 };
 
 /** The occupied bytes of lists in all buffer pools */
@@ -1999,6 +2007,14 @@ struct buf_pool_stat_t{
 				buf_page_peek_if_too_old() */
 	ulint	LRU_bytes;	/*!< LRU size in bytes */
 	ulint	flush_list_bytes;/*!< flush_list size in bytes */
+	ulint	n_pc_passes;	/*!< number of page cleaner passes
+				over this instance */
+	ulint	n_pc_flushed_lru;/*!< number of pages flushed from the
+				LRU tail by the page cleaner */
+	ulint	n_pc_flushed_list;/*!< number of pages flushed from
+				flush_list by the page cleaner */
+	ulint	pc_flush_time;	/*!< milliseconds spent by the page
+				cleaner flushing this instance */
 };
 
 /** Statistics of buddy blocks of a given size. */
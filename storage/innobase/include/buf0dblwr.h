@@ -99,14 +99,15 @@ written to the dblwr buffer on disk. */
 void
 buf_dblwr_sync_datafiles();
 
-/********************************************************************//**
-Flushes possible buffered writes from the doublewrite memory buffer to disk,
-and also wakes up the aio thread if simulated aio is used. It is very
+/** Flushes possible buffered writes from the doublewrite memory buffer to
+disk, and also wakes up the aio thread if simulated aio is used. It is very
 important to call this function after a batch of writes has been posted,
 and also when we may have to wait for a page latch! Otherwise a deadlock
-of threads can occur. */
+of threads can occur.
+@param[in]	buf_pool	buffer pool instance whose batch to flush,
+				or NULL to flush the batches of all instances */
 void
-buf_dblwr_flush_buffered_writes();
+buf_dblwr_flush_buffered_writes(const buf_pool_t* buf_pool = NULL);
 
 /********************************************************************//**
 Writes a page to the doublewrite buffer on disk, sync it, then write
@@ -122,21 +123,39 @@ buf_dblwr_write_single_page(
 	buf_page_t*	bpage,	/*!< in: buffer block to write */
 	bool		sync);	/*!< in: true if sync IO requested */
 
-/** Doublewrite control struct */
-struct buf_dblwr_t{
-	ib_mutex_t	mutex;	/*!< mutex protecting the first_free
-				field and write_buf */
-	ulint		block1;	/*!< the page number of the first
-				doublewrite block (64 pages) */
-	ulint		block2;	/*!< page number of the second block */
-	ulint		first_free;/*!< first free position in write_buf
-				measured in units of srv_page_size */
+/** Minimum number of doublewrite buffer pages in a batch shard */
+#define BUF_DBLWR_MIN_SHARD_SIZE	32
+
+/** A part of the batch flush area of the doublewrite buffer. Each buffer
+pool instance posts its LRU and flush list batches to one shard, so that
+the page cleaner threads do not wait for each other's batches. */
+struct buf_dblwr_shard_t{
+	ib_mutex_t	mutex;	/*!< mutex protecting the fields below */
+	ulint		start;	/*!< first slot of the shard in
+				write_buf and buf_block_arr */
+	ulint		size;	/*!< number of slots in the shard */
+	ulint		first_free;/*!< first free position in the shard,
+				relative to start */
 	ulint		b_reserved;/*!< number of slots currently reserved
 				for batch flush. */
 	os_event_t	b_event;/*!< event where threads wait for a
 				batch flush to end;
 				os_event_set() and os_event_reset()
-				are protected by buf_dblwr_t::mutex */
+				are protected by mutex */
+	bool		batch_running;/*!< set to TRUE if currently a batch
+				is being written from the shard. */
+};
+
+/** Doublewrite control struct */
+struct buf_dblwr_t{
+	ib_mutex_t	mutex;	/*!< mutex protecting the single page
+				flush slots */
+	ulint		block1;	/*!< the page number of the first
+				doublewrite block (64 pages) */
+	ulint		block2;	/*!< page number of the second block */
+	buf_dblwr_shard_t* shards;/*!< the batch flush area, split
+				into shards */
+	ulint		n_shards;/*!< number of shards */
 	ulint		s_reserved;/*!< number of slots currently
 				reserved for single page flushes. */
 	os_event_t	s_event;/*!< event where threads wait for a
@@ -144,9 +163,10 @@ struct buf_dblwr_t{
 	bool*		in_use;	/*!< flag used to indicate if a slot is
 				in use. Only used for single page
 				flushes. */
-	bool		batch_running;/*!< set to TRUE if currently a batch
-				is being written from the doublewrite
-				buffer. */
+	ulint*		s_free;	/*!< stack of the single page flush
+				slots that are not in use; the number
+				of entries is the number of slots minus
+				s_reserved. Protected by mutex. */
 	byte*		write_buf;/*!< write buffer used in writing to the
 				doublewrite buffer, aligned to an
 				address divisible by srv_page_size
@@ -156,6 +176,9 @@ struct buf_dblwr_t{
 	buf_page_t**	buf_block_arr;/*!< array to store pointers to
 				the buffer blocks which have been
 				cached to write_buf */
+	ulint*		space_ids;/*!< tablespace identifiers of the
+				pages in buf_block_arr, for the batch
+				flush area */
 };
 
 #endif
@@ -989,6 +989,11 @@ struct dict_index_t {
 # define DICT_INDEX_MAGIC_N	76789786
 #endif
 	dict_field_t*	fields;	/*!< array of field descriptions */
+	/** rec_offs_base() of leaf-page records, if every field is
+	NOT NULL and fixed-length in ROW_FORMAT!=REDUNDANT, so that
+	rec_get_offsets() is the same for all records; or NULL.
+	Not to be used while is_instant(). */
+	const ulint*	fixed_offsets;
 	st_mysql_ftparser*
 			parser;	/*!< fulltext parser plugin */
 	bool		has_new_v_col;
@@ -2135,8 +2140,8 @@ struct dict_table_t {
 
 	/** Count of the number of record locks on this table. We use this to
 	determine whether we can evict the table from the dictionary cache.
-	It is protected by lock_sys.mutex. */
-	ulint					n_rec_locks;
+	Modified while holding lock_sys.latch, which may be shared. */
+	Atomic_counter<ulint>			n_rec_locks;
 
 private:
 	/** Count of how many handles are opened to this table. Dropping of the
@@ -2206,6 +2211,9 @@ inline void dict_index_t::clear_instant_add()
 	}
 	n_core_fields = n_fields;
 	n_core_null_bytes = UT_BITS_IN_BYTES(unsigned(n_nullable));
+	/* The fields may have been added after fixed_offsets was
+	computed. */
+	fixed_offsets = NULL;
 }
 
 inline void dict_index_t::clear_instant_alter()
@@ -2248,6 +2256,7 @@ inline void dict_index_t::clear_instant_alter()
 	DBUG_ASSERT(&fields[n_fields - table->n_dropped()] == end);
 	n_core_fields = n_fields = n_def = end - fields;
 	n_core_null_bytes = UT_BITS_IN_BYTES(n_nullable);
+	fixed_offsets = NULL;
 	std::sort(begin, end, [](const dict_field_t& a, const dict_field_t& b)
 			      { return a.col->ind < b.col->ind; });
 	table->instant = NULL;
@@ -32,6 +32,12 @@ Created 5/20/1997 Heikki Tuuri
 
 struct hash_table_t;
 struct hash_cell_t;
+#ifdef BTR_CUR_HASH_ADAPT
+struct ha_node_t;
+
+/** Number of modification counters of an adaptive hash index table */
+static const ulint HA_SEQ_STRIPES = 1024;
+#endif /* BTR_CUR_HASH_ADAPT */
 
 typedef void*	hash_node_t;
 
@@ -478,6 +484,18 @@ struct hash_table_t {
 					table of the adaptive hash
 					index */
 # endif /* UNIV_AHI_DEBUG || UNIV_DEBUG */
+	/** Modification counters of an adaptive hash index table, or
+	NULL. Each counter covers the hash chains whose cell number is
+	congruent to it modulo HA_SEQ_STRIPES. It is incremented before
+	and after each change of those chains, so that it is odd while a
+	change is in progress. Lets btr_search_guess_on_hash() validate
+	a lookup that was made without holding the latch. */
+	std::atomic<ulint>*	seq;
+	/** Deleted nodes of an adaptive hash index table, linked by
+	ha_node_t::next. They are reused by ha_insert_for_fold() and only
+	freed by btr_search_disable(), because a lookup without the latch
+	may still be reading them. */
+	ha_node_t*		free_nodes;
 #endif /* BTR_CUR_HASH_ADAPT */
 	ulint			n_cells;/* number of cells in the hash table */
 	hash_cell_t*		array;	/*!< pointer to cell array */
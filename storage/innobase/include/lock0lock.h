@@ -450,13 +450,13 @@ lock_table(
 	lock_mode	mode,	/*!< in: lock mode */
 	que_thr_t*	thr)	/*!< in: query thread */
 	MY_ATTRIBUTE((warn_unused_result));
-/*********************************************************************//**
-Creates a table IX lock object for a resurrected transaction. */
+/** Create a table lock object for a resurrected transaction.
+@param[in,out]	table	table
+@param[in,out]	trx	recovered transaction
+@param[in]	mode	LOCK_IX, or LOCK_X if the transaction
+wrote a TRX_UNDO_EMPTY record for the table */
 void
-lock_table_ix_resurrect(
-/*====================*/
-	dict_table_t*	table,	/*!< in/out: table */
-	trx_t*		trx);	/*!< in/out: transaction */
+lock_table_resurrect(dict_table_t* table, trx_t* trx, lock_mode mode);
 
 /** Sets a lock on a table based on the given mode.
 @param[in]	table	table to lock
@@ -763,8 +763,20 @@ class lock_sys_t
 
 public:
 	MY_ALIGNED(CACHE_LINE_SIZE)
-	LockMutex	mutex;			/*!< Mutex protecting the
-						locks */
+	rw_lock_t	latch;			/*!< Latch protecting the
+						locks. Held in exclusive
+						mode, except by the fast
+						paths of lock_rec_lock()
+						and lock_table(), which
+						hold it in shared mode
+						together with one of
+						shard_mutexes[] */
+	ib_mutex_t*	shard_mutexes;		/*!< N_SHARDS mutexes, each
+						protecting a subset of
+						the rec_hash cells and of
+						the table lock queues
+						while latch is held in
+						shared mode */
 	hash_table_t*	rec_hash;		/*!< hash table of the record
 						locks */
 	hash_table_t*	prdt_hash;		/*!< hash table of the predicate
@@ -831,6 +843,48 @@ class lock_sys_t
 
   /** Closes the lock system at database shutdown. */
   void close();
+
+  /** Number of shard_mutexes[] */
+  static const ulint N_SHARDS = 256;
+
+  /** Get the mutex protecting a rec_hash cell in shared latch mode.
+  @param[in] cell rec_hash cell, as returned by lock_rec_hash()
+  @return the shard mutex */
+  ib_mutex_t* rec_shard(ulint cell) const
+  {
+    return &shard_mutexes[cell & (N_SHARDS - 1)];
+  }
+
+  /** Get the mutex protecting the lock queue of a table in shared
+  latch mode.
+  @param[in] id table identifier
+  @return the shard mutex */
+  ib_mutex_t* table_shard(table_id_t id) const
+  {
+    return &shard_mutexes[ut_fold_ull(id) & (N_SHARDS - 1)];
+  }
+
+#ifdef UNIV_DEBUG
+  /** Check if the current thread may access the record locks of a cell.
+  @param[in] cell rec_hash cell
+  @return whether latch is held exclusively, or shared together with
+  the shard mutex of the cell */
+  bool rec_cell_own(ulint cell)
+  {
+    return rw_lock_own(&latch, RW_LOCK_X)
+      || (rw_lock_own(&latch, RW_LOCK_S) && mutex_own(rec_shard(cell)));
+  }
+
+  /** Check if the current thread may access the lock queue of a table.
+  @param[in] id table identifier
+  @return whether latch is held exclusively, or shared together with
+  the shard mutex of the table */
+  bool table_own(table_id_t id)
+  {
+    return rw_lock_own(&latch, RW_LOCK_X)
+      || (rw_lock_own(&latch, RW_LOCK_S) && mutex_own(table_shard(id)));
+  }
+#endif /* UNIV_DEBUG */
 };
 
 /*********************************************************************//**
@@ -946,21 +1000,23 @@ lock_rec_free_all_from_discard_page(
 /** The lock system */
 extern lock_sys_t lock_sys;
 
-/** Test if lock_sys.mutex can be acquired without waiting. */
+/** Test if lock_sys.latch can be acquired in exclusive mode without
+waiting.
+@return 0 if the latch was acquired */
 #define lock_mutex_enter_nowait() 		\
-	(lock_sys.mutex.trylock(__FILE__, __LINE__))
+	(!rw_lock_x_lock_nowait(&lock_sys.latch))
 
-/** Test if lock_sys.mutex is owned. */
-#define lock_mutex_own() (lock_sys.mutex.is_owned())
+/** Test if lock_sys.latch is exclusively owned. */
+#define lock_mutex_own() rw_lock_own(&lock_sys.latch, RW_LOCK_X)
 
-/** Acquire the lock_sys.mutex. */
+/** Acquire the lock_sys.latch in exclusive mode. */
 #define lock_mutex_enter() do {			\
-	mutex_enter(&lock_sys.mutex);		\
+	rw_lock_x_lock(&lock_sys.latch);	\
 } while (0)
 
-/** Release the lock_sys.mutex. */
+/** Release the exclusive lock_sys.latch. */
 #define lock_mutex_exit() do {			\
-	lock_sys.mutex.exit();			\
+	rw_lock_x_unlock(&lock_sys.latch);	\
 } while (0)
 
 /** Test if lock_sys.wait_mutex is owned. */
@@ -106,6 +106,34 @@ log_write_low(
 /*==========*/
 	const byte*	str,		/*!< in: string */
 	ulint		str_len);	/*!< in: string length */
+/** Reserve space in the log buffer for a string, without copying it.
+The caller must hold log_sys.mutex, and must invoke log_close() before
+releasing it. The string must then be copied by log_write_reserved()
+and the reservation released by log_reserve_release(). Until then,
+the log buffer will not be written to the file.
+@param[in]	len		length of the string
+@param[out]	start_lsn	start LSN of the string
+@return	the position of the string in log_sys.buf */
+byte*
+log_reserve(
+	ulint	len,
+	lsn_t*	start_lsn);
+
+/** Copy a string to space that was reserved by log_reserve(),
+skipping the log block trailers and headers. This does not require
+log_sys.mutex.
+@param[in,out]	ptr	position in log_sys.buf; advanced past the string
+@param[in]	str	string
+@param[in]	len	length of the string */
+void
+log_write_reserved(
+	byte*&		ptr,
+	const byte*	str,
+	ulint		len);
+
+/** Release a reservation after log_write_reserved() has completed. */
+inline void log_reserve_release();
+
 /************************************************************//**
 Closes the log.
 @return lsn */
@@ -521,6 +549,19 @@ struct log_t{
 					peeked at by log_free_check(), which
 					does not reserve the log mutex */
 
+	/** number of log_reserve() calls whose string is still being
+	copied by log_write_reserved(); while log_sys.mutex is held,
+	this can only decrease. Decremented with release semantics, so
+	that the copied payload is visible to whoever observes the
+	decrement with acquire semantics. */
+	MY_ALIGNED(CACHE_LINE_SIZE)
+	std::atomic<ulint>	n_pending_copies;
+	/** whether log_wait_for_copies() is waiting for copies_event;
+	protected by mutex for writes */
+	std::atomic<bool>	copies_waiting;
+	/** set by the last log_reserve_release() while copies_waiting */
+	os_event_t		copies_event;
+
   /** Log files. Protected by mutex or write_mutex. */
   struct files {
     /** number of files */
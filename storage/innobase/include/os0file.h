@@ -1396,6 +1396,18 @@ Frees the asynchronous io system. */
 void
 os_aio_free();
 
+#ifdef HAVE_IO_URING
+struct iovec;
+
+/** Register memory regions, such as the buffer pool chunks, for
+fixed-buffer reads and writes with io_uring. Any earlier registration
+is replaced.
+@param[in]	iov	memory regions
+@param[in]	n	number of regions; 0 unregisters */
+void
+os_aio_register_buffers(const iovec* iov, ulint n);
+#endif /* HAVE_IO_URING */
+
 /**
 NOTE! Use the corresponding macro os_aio(), not directly this function!
 Requests an asynchronous i/o operation.
@@ -272,6 +272,16 @@ page_cur_search(
 	const dtuple_t*		tuple,
 	page_cur_t*		cursor);
 
+/** Determine whether page_cur_search_with_match() can compare the first
+field of a search tuple as an integer read straight from the records,
+without rec_get_offsets().
+@param[in]	index	B-tree index
+@param[in]	tuple	search tuple
+@return length of the first field
+@retval 0 if the records must be compared with cmp_dtuple_rec_with_match() */
+ulint
+page_cur_key_prefix_len(const dict_index_t* index, const dtuple_t* tuple)
+	MY_ATTRIBUTE((nonnull, warn_unused_result));
 /****************************************************************//**
 Searches the right position for a page cursor. */
 void
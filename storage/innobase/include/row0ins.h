@@ -31,6 +31,7 @@ Created 4/20/1996 Heikki Tuuri
 #include "que0types.h"
 #include "trx0types.h"
 #include "row0types.h"
+#include "btr0types.h"
 
 /***************************************************************//**
 Checks if foreign key constraint fails for an index entry. Sets shared locks
@@ -92,7 +93,10 @@ row_ins_clust_index_entry_low(
 	ulint		n_uniq,	/*!< in: 0 or index->n_uniq */
 	dtuple_t*	entry,	/*!< in/out: index entry to insert */
 	ulint		n_ext,	/*!< in: number of externally stored columns */
-	que_thr_t*	thr)	/*!< in: query thread or NULL */
+	que_thr_t*	thr,	/*!< in: query thread or NULL */
+	btr_leaf_guess_t* guess = NULL)
+				/*!< in/out: leaf page to try before
+				descending from the root, or NULL */
 	MY_ATTRIBUTE((warn_unused_result));
 
 /***************************************************************//**
@@ -132,7 +136,15 @@ row_ins_clust_index_entry(
 	dict_index_t*	index,	/*!< in: clustered index */
 	dtuple_t*	entry,	/*!< in/out: index entry to insert */
 	que_thr_t*	thr,	/*!< in: query thread */
-	ulint		n_ext)	/*!< in: number of externally stored columns */
+	ulint		n_ext,	/*!< in: number of externally stored columns */
+	btr_leaf_guess_t* guess = NULL,
+				/*!< in/out: leaf page to try before
+				descending from the root, or NULL */
+	ulint		bulk_flags = 0)
+				/*!< in: BTR_NO_UNDO_LOG_FLAG
+				| BTR_NO_LOCKING_FLAG
+				| BTR_BULK_INSERT_FLAG if the statement
+				is loading an empty table, else 0 */
 	MY_ATTRIBUTE((warn_unused_result));
 /***************************************************************//**
 Inserts an entry into a secondary index. Tries first optimistic,
@@ -159,6 +171,18 @@ row_ins_step(
 /*=========*/
 	que_thr_t*	thr);	/*!< in: query thread */
 
+/** State of an empty-table bulk insert (ins_node_t::bulk) */
+enum ins_bulk_t {
+	/** not determined yet for the statement */
+	INS_BULK_UNKNOWN = 0,
+	/** the rows are inserted normally */
+	INS_BULK_NONE,
+	/** the table was empty at the start of the statement, and it is
+	locked exclusively; a TRX_UNDO_EMPTY undo log record was written,
+	and the rows are inserted without undo log or record locks */
+	INS_BULK_EMPTY
+};
+
 /* Insert node structure */
 
 struct ins_node_t{
@@ -189,6 +213,15 @@ struct ins_node_t{
 				entry_list and sys fields are stored here;
 				if this is NULL, entry list should be created
 				and buffers for sys fields in row allocated */
+	/** whether the statement is a bulk insert
+	(ha_innobase::start_bulk_insert()) */
+	bool		bulk_insert;
+	/** the clustered index leaf page of the previous insert of
+	a bulk insert, for the next one to try first */
+	btr_leaf_guess_t leaf_guess;
+	/** whether the bulk insert is loading an empty table;
+	reset by ha_innobase::start_bulk_insert() */
+	ins_bulk_t	bulk;
 	ulint		magic_n;
 };
 
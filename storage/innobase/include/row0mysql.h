@@ -762,6 +762,9 @@ struct row_prebuilt_t {
 	bool		in_fts_query;	/*!< Whether we are in a FTS query */
 	bool		fts_doc_id_in_read_set; /*!< true if table has externally
 					defined FTS_DOC_ID coulmn. */
+	bool		bulk_insert;	/*!< whether the statement announced
+					its inserts by
+					ha_innobase::start_bulk_insert() */
 	/*----------------------*/
 	ulonglong	autoinc_last_value;
 					/*!< last value of AUTO-INC interval */
@@ -277,6 +277,9 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 extern my_bool	srv_use_native_aio;
+/** innodb_use_io_uring: whether to use io_uring instead of libaio
+for the native asynchronous I/O on Linux */
+extern my_bool	srv_use_io_uring;
 extern my_bool	srv_numa_interleave;
 
 /* Use atomic writes i.e disable doublewrite buffer */
@@ -399,6 +402,8 @@ extern my_bool	srv_random_read_ahead;
 extern ulong	srv_read_ahead_threshold;
 extern ulong	srv_n_read_io_threads;
 extern ulong	srv_n_write_io_threads;
+/** innodb_recovery_threads */
+extern uint	srv_n_recovery_threads;
 
 /* Defragmentation, Origianlly facebook default value is 100, but it's too high */
 #define SRV_DEFRAGMENT_FREQUENCY_DEFAULT 40
@@ -435,6 +440,9 @@ extern ulong	srv_innodb_stats_method;
 extern ulint	srv_max_n_open_files;
 
 extern ulong	srv_n_page_cleaners;
+/** innodb_page_cleaner_independent; whether each buffer pool instance
+is flushed on its own schedule instead of in common rounds */
+extern my_bool	srv_page_cleaner_independent;
 
 extern double	srv_max_dirty_pages_pct;
 extern double	srv_max_dirty_pages_pct_lwm;
@@ -468,6 +476,8 @@ extern my_bool			srv_stats_sample_traditional;
 
 extern my_bool	srv_use_doublewrite_buf;
 extern ulong	srv_doublewrite_batch_size;
+/** innodb_doublewrite_shards */
+extern ulong	srv_doublewrite_shards;
 extern ulong	srv_checksum_algorithm;
 
 extern double	srv_max_buf_pool_modified_pct;
@@ -29,6 +29,7 @@ Created 3/26/1996 Heikki Tuuri
 
 #include "trx0rseg.h"
 #include "que0types.h"
+#include "ut0vec.h"
 
 #include <queue>
 
@@ -166,6 +167,16 @@ class purge_sys_t
 	and srv_worker_thread by std::atomic. */
 	std::atomic<ulint>	n_tasks;
 
+	/** Memory heap for the undo log records of the current batch;
+	emptied by srv_purge_coordinator between batches */
+	mem_heap_t*	heap;
+	/** The undo log records of the current batch, cut into chunks
+	that each cover a single table. Written by srv_purge_coordinator
+	before a batch is started, read-only while it is running. */
+	std::vector<ib_vector_t*, ut_allocator<ib_vector_t*> >	chunks;
+	/** index of the next chunk in chunks to be claimed */
+	Atomic_counter<ulint>	next_chunk;
+
 	/** Iterator to the undo log records of committed transactions */
 	struct iterator
 	{
@@ -264,6 +275,14 @@ class purge_sys_t
     m_enabled.store(false, std::memory_order_relaxed);
   }
 
+  /** Claim the next chunk of undo log records of the current batch.
+  @return the undo log records to purge, or NULL if none are left */
+  ib_vector_t* claim_chunk()
+  {
+    ulint i= next_chunk++;
+    return i < chunks.size() ? chunks[i] : NULL;
+  }
+
   /** @return whether the purge coordinator thread is active */
   bool running();
   /** Stop purge during FLUSH TABLES FOR EXPORT */
@@ -791,6 +791,105 @@ class rw_trx_hash_t
 };
 
 
+/**
+  Copy of the most recent MVCC snapshot.
+
+  Taking a snapshot walks rw_trx_hash, which gets expensive with many
+  concurrent transactions. As long as no read-write transaction has been
+  registered, deregistered or assigned a serialisation number since, the
+  previous snapshot is still exact and can be copied instead.
+
+  The copy is protected by a sequence lock: m_seq is odd while the copy
+  is being replaced. Readers never wait; if the copy is being replaced
+  or is out of date, they walk rw_trx_hash as usual. All fields are
+  atomic so that a reader racing with a writer merely gets a copy that
+  it will discard.
+*/
+class snapshot_cache_t
+{
+  /** Maximum number of transaction identifiers in the copy */
+  static const size_t MAX_IDS= 4096;
+
+  /** sequence number, odd while the copy is being replaced */
+  MY_ALIGNED(CACHE_LINE_SIZE) std::atomic<uint64_t> m_seq;
+  /** trx_sys.get_max_trx_id() at the time of the snapshot */
+  std::atomic<trx_id_t> m_max_trx_id;
+  /** trx_sys.m_rw_trx_hash_deregistered at the time of the snapshot */
+  std::atomic<uint64_t> m_deregistered;
+  /** min(trx->no) of the snapshot */
+  std::atomic<trx_id_t> m_min_trx_no;
+  /** number of elements in m_ids */
+  std::atomic<size_t> m_n_ids;
+  /** sorted identifiers of the active read-write transactions */
+  std::atomic<trx_id_t> m_ids[MAX_IDS];
+
+public:
+  /** Invalidate the copy. */
+  void init()
+  {
+    m_seq.store(0, std::memory_order_relaxed);
+    m_max_trx_id.store(0, std::memory_order_relaxed);
+    m_n_ids.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+    Copies the snapshot if it is still exact.
+
+    @param[in]  max_trx_id    current trx_sys.get_max_trx_id()
+    @param[in]  deregistered  current trx_sys.m_rw_trx_hash_deregistered
+    @param[out] ids           sorted active transaction identifiers
+    @param[out] min_trx_no    min(trx->no)
+    @return whether ids and min_trx_no were assigned
+  */
+  bool get(trx_id_t max_trx_id, uint64_t deregistered, trx_ids_t *ids,
+           trx_id_t *min_trx_no)
+  {
+    const uint64_t seq= m_seq.load(std::memory_order_acquire);
+    if ((seq & 1) ||
+        m_max_trx_id.load(std::memory_order_relaxed) != max_trx_id ||
+        m_deregistered.load(std::memory_order_relaxed) != deregistered)
+      return false;
+    size_t n_ids= m_n_ids.load(std::memory_order_relaxed);
+    if (n_ids > MAX_IDS)
+      n_ids= MAX_IDS;
+    ids->clear();
+    ids->reserve(n_ids + 32);
+    for (size_t i= 0; i < n_ids; i++)
+      ids->push_back(m_ids[i].load(std::memory_order_relaxed));
+    *min_trx_no= m_min_trx_no.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return m_seq.load(std::memory_order_relaxed) == seq;
+  }
+
+  /**
+    Replaces the copy, unless another thread is doing so.
+
+    @param[in] max_trx_id    trx_sys.get_max_trx_id() of the snapshot
+    @param[in] deregistered  trx_sys.m_rw_trx_hash_deregistered, read before
+                             the snapshot was taken
+    @param[in] ids           sorted active transaction identifiers
+    @param[in] min_trx_no    min(trx->no)
+  */
+  void put(trx_id_t max_trx_id, uint64_t deregistered, const trx_ids_t &ids,
+           trx_id_t min_trx_no)
+  {
+    uint64_t seq= m_seq.load(std::memory_order_relaxed);
+    if (ids.size() > MAX_IDS || (seq & 1) ||
+        !m_seq.compare_exchange_strong(seq, seq + 1,
+                                       std::memory_order_relaxed))
+      return;
+    std::atomic_thread_fence(std::memory_order_release);
+    m_max_trx_id.store(max_trx_id, std::memory_order_relaxed);
+    m_deregistered.store(deregistered, std::memory_order_relaxed);
+    m_min_trx_no.store(min_trx_no, std::memory_order_relaxed);
+    m_n_ids.store(ids.size(), std::memory_order_relaxed);
+    for (size_t i= 0; i < ids.size(); i++)
+      m_ids[i].store(ids[i], std::memory_order_relaxed);
+    m_seq.store(seq + 2, std::memory_order_release);
+  }
+};
+
+
 /** The transaction system central memory data structure. */
 class trx_sys_t
 {
@@ -812,6 +911,18 @@ class trx_sys_t
   MY_ALIGNED(CACHE_LINE_SIZE) std::atomic<trx_id_t> m_rw_trx_hash_version;
 
 
+  /**
+    Number of deregister_rw() calls. Together with m_rw_trx_hash_version
+    it tells whether the set of active read-write transactions could have
+    changed since a snapshot was taken.
+  */
+  std::atomic<uint64_t> m_rw_trx_hash_deregistered;
+
+
+  /** Copy of the most recent MVCC snapshot */
+  snapshot_cache_t m_snapshot_cache;
+
+
   bool m_initialised;
 
 public:
@@ -958,8 +1069,15 @@ class trx_sys_t
     of rw_trx_hash.iterate_no_dups(). It means that some transaction
     identifiers may appear multiple times in ids.
 
+    If no read-write transaction was registered, deregistered or assigned a
+    serialisation number since the previous snapshot, that snapshot is
+    copied from m_snapshot_cache instead of walking rw_trx_hash.
+    m_rw_trx_hash_deregistered is read before walking rw_trx_hash, so that
+    a transaction deregistered during the walk invalidates the copy.
+
     @param[in,out] caller_trx used to get access to rw_trx_hash_pins
-    @param[out]    ids        array to store registered transaction identifiers
+    @param[out]    ids        sorted array to store registered transaction
+                              identifiers
     @param[out]    max_trx_id variable to store m_max_trx_id value
     @param[out]    mix_trx_no variable to store min(trx->no) value
   */
@@ -973,15 +1091,23 @@ class trx_sys_t
     while ((arg.m_id= get_rw_trx_hash_version()) != get_max_trx_id())
       ut_delay(1);
     arg.m_no= arg.m_id;
+    *max_trx_id= arg.m_id;
+
+    const uint64_t deregistered=
+      m_rw_trx_hash_deregistered.load(std::memory_order_acquire);
+
+    if (m_snapshot_cache.get(arg.m_id, deregistered, ids, min_trx_no))
+      return;
 
     ids->clear();
     ids->reserve(rw_trx_hash.size() + 32);
     rw_trx_hash.iterate(caller_trx,
                         reinterpret_cast<my_hash_walk_action>(copy_one_id),
                         &arg);
+    std::sort(ids->begin(), ids->end());
 
-    *max_trx_id= arg.m_id;
     *min_trx_no= arg.m_no;
+    m_snapshot_cache.put(arg.m_id, deregistered, *ids, arg.m_no);
   }
 
 
@@ -990,6 +1116,8 @@ class trx_sys_t
   {
     m_max_trx_id= value;
     m_rw_trx_hash_version.store(value, std::memory_order_relaxed);
+    m_rw_trx_hash_deregistered.store(0, std::memory_order_relaxed);
+    m_snapshot_cache.init();
   }
 
 
@@ -1044,6 +1172,7 @@ class trx_sys_t
   void deregister_rw(trx_t *trx)
   {
     rw_trx_hash.erase(trx);
+    m_rw_trx_hash_deregistered.fetch_add(1, std::memory_order_release);
   }
 
 
@@ -62,6 +62,26 @@ IF(UNIX)
     IF(HAVE_LIBAIO_H AND HAVE_LIBAIO)
       ADD_DEFINITIONS(-DLINUX_NATIVE_AIO=1)
       LINK_LIBRARIES(aio)
+      # io_uring is used through system calls; only the kernel
+      # header is needed at build time. The timed wait needs
+      # IORING_ENTER_EXT_ARG, which appeared in the Linux 5.11 headers.
+      CHECK_C_SOURCE_COMPILES("
+      #include <linux/io_uring.h>
+      #include <sys/syscall.h>
+      int main()
+      {
+        struct io_uring_params p;
+        struct io_uring_getevents_arg arg;
+        struct __kernel_timespec ts;
+        p.features = IORING_FEAT_EXT_ARG | IORING_FEAT_SINGLE_MMAP;
+        arg.ts = (unsigned long) &ts;
+        return __NR_io_uring_enter + __NR_io_uring_setup
+          + __NR_io_uring_register + IORING_ENTER_EXT_ARG
+          + (int) p.features + (int) arg.ts;
+      }" HAVE_IO_URING_EXT_ARG)
+      IF(HAVE_IO_URING_EXT_ARG)
+        ADD_DEFINITIONS(-DHAVE_IO_URING=1)
+      ENDIF()
     ENDIF()
     IF(HAVE_LIBNUMA)
       LINK_LIBRARIES(numa)
@@ -36,6 +36,7 @@ Created 5/7/1996 Heikki Tuuri
 #include "dict0mem.h"
 #include "trx0purge.h"
 #include "trx0sys.h"
+#include "sync0sync.h"
 #include "ut0vec.h"
 #include "btr0cur.h"
 #include "row0sel.h"
@@ -457,7 +458,14 @@ void lock_sys_t::create(ulint n_cells)
 		(ut_zalloc_nokey(srv_max_n_threads * sizeof *waiting_threads));
 	last_slot = waiting_threads;
 
-	mutex_create(LATCH_ID_LOCK_SYS, &mutex);
+	rw_lock_create(lock_latch_key, &latch, SYNC_LOCK_SYS);
+
+	shard_mutexes = static_cast<ib_mutex_t*>(
+		ut_malloc_nokey(N_SHARDS * sizeof *shard_mutexes));
+
+	for (ulint i = 0; i < N_SHARDS; i++) {
+		mutex_create(LATCH_ID_LOCK_SYS_SHARD, &shard_mutexes[i]);
+	}
 
 	mutex_create(LATCH_ID_LOCK_SYS_WAIT, &wait_mutex);
 
@@ -495,7 +503,7 @@ void lock_sys_t::resize(ulint n_cells)
 {
 	ut_ad(this == &lock_sys);
 
-	mutex_enter(&mutex);
+	rw_lock_x_lock(&latch);
 
 	hash_table_t* old_hash = rec_hash;
 	rec_hash = hash_create(n_cells);
@@ -540,7 +548,7 @@ void lock_sys_t::resize(ulint n_cells)
 		buf_pool_mutex_exit(buf_pool);
 	}
 
-	mutex_exit(&mutex);
+	rw_lock_x_unlock(&latch);
 }
 
 
@@ -562,7 +570,14 @@ void lock_sys_t::close()
 
 	os_event_destroy(timeout_event);
 
-	mutex_destroy(&mutex);
+	rw_lock_free(&latch);
+
+	for (ulint i = 0; i < N_SHARDS; i++) {
+		mutex_destroy(&shard_mutexes[i]);
+	}
+
+	ut_free(shard_mutexes);
+
 	mutex_destroy(&wait_mutex);
 
 	for (ulint i = srv_max_n_threads; i--; ) {
@@ -1340,7 +1355,7 @@ lock_rec_create_low(
 	ulint		n_bits;
 	ulint		n_bytes;
 
-	ut_ad(lock_mutex_own());
+	ut_ad(lock_sys.rec_cell_own(lock_rec_hash(space, page_no)));
 	ut_ad(holds_trx_mutex == trx_mutex_own(trx));
 	ut_ad(dict_index_is_clust(index) || !dict_index_is_online_ddl(index));
 
@@ -1502,8 +1517,8 @@ lock_rec_create_low(
 	if (!holds_trx_mutex) {
 		trx_mutex_exit(trx);
 	}
-	MONITOR_INC(MONITOR_RECLOCK_CREATED);
-	MONITOR_INC(MONITOR_NUM_RECLOCK);
+	MONITOR_ATOMIC_INC(MONITOR_RECLOCK_CREATED);
+	MONITOR_ATOMIC_INC(MONITOR_NUM_RECLOCK);
 
 	return lock;
 }
@@ -1901,6 +1916,69 @@ lock_rec_add_to_queue(
 		type_mode, block, heap_no, index, trx, caller_owns_trx_mutex);
 }
 
+/** Try to lock a record while holding lock_sys.latch in shared mode.
+This only succeeds if the page carries no record locks, or if the only
+lock on the page is a granted lock of the same transaction in the same
+mode, because then no conflict, wait or deadlock is possible.
+@param[in]	impl	if true, no lock is set if no wait is necessary
+@param[in]	mode	LOCK_X or LOCK_S possibly ORed to either
+			LOCK_GAP or LOCK_REC_NOT_GAP
+@param[in]	block	buffer block containing the record
+@param[in]	heap_no	heap number of the record
+@param[in]	index	index of the record
+@param[in,out]	trx	transaction
+@param[out]	err	DB_SUCCESS or DB_SUCCESS_LOCKED_REC
+@return whether the request was handled */
+static
+bool
+lock_rec_lock_try_fast(
+	bool			impl,
+	ulint			mode,
+	const buf_block_t*	block,
+	ulint			heap_no,
+	dict_index_t*		index,
+	trx_t*			trx,
+	dberr_t*		err)
+{
+	bool	done = true;
+
+	*err = DB_SUCCESS;
+
+	rw_lock_s_lock(&lock_sys.latch);
+
+	ib_mutex_t*	shard = lock_sys.rec_shard(
+		buf_block_get_lock_hash_val(block));
+
+	mutex_enter(shard);
+
+	if (lock_t* lock = lock_rec_get_first_on_page(lock_sys.rec_hash,
+						      block)) {
+		if (lock_rec_get_next_on_page(lock)
+		    || lock->trx != trx
+		    || lock->type_mode != (mode | LOCK_REC)
+		    || lock_rec_get_n_bits(lock) <= heap_no) {
+			done = false;
+		} else if (!impl && !lock_rec_get_nth_bit(lock, heap_no)) {
+			trx_mutex_enter(trx);
+			lock_rec_set_nth_bit(lock, heap_no);
+			trx_mutex_exit(trx);
+			*err = DB_SUCCESS_LOCKED_REC;
+		}
+	} else if (!impl) {
+		lock_rec_create(
+#ifdef WITH_WSREP
+			NULL, NULL,
+#endif
+			mode, block, heap_no, index, trx, false);
+		*err = DB_SUCCESS_LOCKED_REC;
+	}
+
+	mutex_exit(shard);
+	rw_lock_s_unlock(&lock_sys.latch);
+
+	return(done);
+}
+
 /*********************************************************************//**
 Tries to lock the specified record in the mode requested. If not immediately
 possible, enqueues a waiting lock request. This is a low-level function
@@ -1936,13 +2014,21 @@ lock_rec_lock(
         (mode & LOCK_TYPE_MASK) == 0);
   ut_ad(dict_index_is_clust(index) || !dict_index_is_online_ddl(index));
   DBUG_EXECUTE_IF("innodb_report_deadlock", return DB_DEADLOCK;);
-
-  lock_mutex_enter();
   ut_ad((LOCK_MODE_MASK & mode) != LOCK_S ||
         lock_table_has(trx, index->table, LOCK_IS));
   ut_ad((LOCK_MODE_MASK & mode) != LOCK_X ||
          lock_table_has(trx, index->table, LOCK_IX));
 
+  /* Most requests are for a page that carries no other locks; those
+  do not need exclusive access to the whole lock system. */
+  if (lock_rec_lock_try_fast(impl, mode, block, heap_no, index, trx, &err))
+  {
+    MONITOR_ATOMIC_INC(MONITOR_NUM_RECLOCK_REQ);
+    return err;
+  }
+
+  lock_mutex_enter();
+
   if (lock_t *lock= lock_rec_get_first_on_page(lock_sys.rec_hash, block))
   {
     trx_mutex_enter(trx);
@@ -3476,7 +3562,7 @@ lock_table_create(
 	lock_t*		lock;
 
 	ut_ad(table && trx);
-	ut_ad(lock_mutex_own());
+	ut_ad(lock_sys.table_own(table->id));
 	ut_ad(trx_mutex_own(trx));
 
 	check_trx_state(trx);
@@ -3568,8 +3654,8 @@ lock_table_create(
 
 	lock->trx->lock.table_locks.push_back(lock);
 
-	MONITOR_INC(MONITOR_TABLELOCK_CREATED);
-	MONITOR_INC(MONITOR_NUM_TABLELOCK);
+	MONITOR_ATOMIC_INC(MONITOR_TABLELOCK_CREATED);
+	MONITOR_ATOMIC_INC(MONITOR_NUM_TABLELOCK);
 
 	return(lock);
 }
@@ -3839,6 +3925,53 @@ lock_table_other_has_incompatible(
 	return(NULL);
 }
 
+/** Try to grant an intention lock on a table while holding lock_sys.latch
+in shared mode. This only succeeds if no other transaction holds or waits
+for an incompatible lock on the table.
+@param[in,out]	table	table
+@param[in]	mode	LOCK_IS or LOCK_IX
+@param[in,out]	trx	transaction
+@return whether the lock was granted */
+static
+bool
+lock_table_try_fast(
+	dict_table_t*	table,
+	lock_mode	mode,
+	trx_t*		trx)
+{
+	ut_ad(mode == LOCK_IS || mode == LOCK_IX);
+
+	bool	granted = true;
+
+	rw_lock_s_lock(&lock_sys.latch);
+
+	ib_mutex_t*	shard = lock_sys.table_shard(table->id);
+
+	mutex_enter(shard);
+
+	for (const lock_t* lock = UT_LIST_GET_LAST(table->locks);
+	     lock != NULL;
+	     lock = UT_LIST_GET_PREV(un_member.tab_lock.locks, lock)) {
+
+		if (lock->trx != trx
+		    && !lock_mode_compatible(lock_get_mode(lock), mode)) {
+			granted = false;
+			break;
+		}
+	}
+
+	if (granted) {
+		trx_mutex_enter(trx);
+		lock_table_create(table, mode, trx);
+		trx_mutex_exit(trx);
+	}
+
+	mutex_exit(shard);
+	rw_lock_s_unlock(&lock_sys.latch);
+
+	return(granted);
+}
+
 /*********************************************************************//**
 Locks the specified database table in the mode given. If the lock cannot
 be granted immediately, the query thread is put to wait.
@@ -3894,6 +4027,20 @@ lock_table(
 		trx_set_rw_mode(trx);
 	}
 
+	/* Intention locks only conflict with LOCK_S and LOCK_X, which are
+	rare. When there are none, exclusive access to the whole lock system
+	is not needed. Galera may have to abort conflicting transactions,
+	which is only done in the exclusive path. */
+	if ((mode == LOCK_IS || mode == LOCK_IX)
+#ifdef WITH_WSREP
+	    && !wsrep_on_trx(trx)
+#endif /* WITH_WSREP */
+	    && !DBUG_EVALUATE_IF("fatal-semaphore-timeout", true, false)
+	    && lock_table_try_fast(table, mode, trx)) {
+
+		return(DB_SUCCESS);
+	}
+
 	lock_mutex_enter();
 
 	DBUG_EXECUTE_IF("fatal-semaphore-timeout",
@@ -3932,17 +4079,18 @@ lock_table(
 	return(err);
 }
 
-/*********************************************************************//**
-Creates a table IX lock object for a resurrected transaction. */
+/** Create a table lock object for a resurrected transaction.
+@param[in,out]	table	table
+@param[in,out]	trx	recovered transaction
+@param[in]	mode	LOCK_IX, or LOCK_X if the transaction
+wrote a TRX_UNDO_EMPTY record for the table */
 void
-lock_table_ix_resurrect(
-/*====================*/
-	dict_table_t*	table,	/*!< in/out: table */
-	trx_t*		trx)	/*!< in/out: transaction */
+lock_table_resurrect(dict_table_t* table, trx_t* trx, lock_mode mode)
 {
 	ut_ad(trx->is_recovered);
+	ut_ad(mode == LOCK_IX || mode == LOCK_X);
 
-	if (lock_table_has(trx, table, LOCK_IX)) {
+	if (lock_table_has(trx, table, mode)) {
 		return;
 	}
 
@@ -3952,10 +4100,10 @@ lock_table_ix_resurrect(
 	other transactions have in the table lock queue. */
 
 	ut_ad(!lock_table_other_has_incompatible(
-		      trx, LOCK_WAIT, table, LOCK_IX));
+		      trx, LOCK_WAIT, table, mode));
 
 	trx_mutex_enter(trx);
-	lock_table_create(table, LOCK_IX, trx);
+	lock_table_create(table, mode, trx);
 	lock_mutex_exit();
 	trx_mutex_exit(trx);
 }
@@ -4268,6 +4416,104 @@ lock_check_dict_lock(
 }
 #endif /* UNIV_DEBUG */
 
+/** Release the locks of a committing transaction that no other transaction
+is waiting for, while holding lock_sys.latch in shared mode. A lock queue
+without waiting requests can be shortened under its shard mutex alone,
+because no lock would be granted by the release, and a waiting request can
+only be enqueued while holding lock_sys.latch exclusively.
+Predicate locks and table locks other than LOCK_IS and LOCK_IX are left to
+lock_release().
+@param[in,out]	trx		committing transaction
+@param[in]	max_trx_id	query cache invalidation limit */
+static void lock_release_try_fast(trx_t* trx, trx_id_t max_trx_id)
+{
+	rw_lock_s_lock(&lock_sys.latch);
+
+	for (lock_t* lock = UT_LIST_GET_LAST(trx->lock.trx_locks), *prev;
+	     lock != NULL; lock = prev) {
+
+		prev = UT_LIST_GET_PREV(trx_locks, lock);
+
+		ut_d(lock_check_dict_lock(lock));
+
+		if (lock_get_type_low(lock) == LOCK_REC) {
+			if (lock_hash_get(lock->type_mode)
+			    != lock_sys.rec_hash) {
+				continue;
+			}
+
+			ulint	space = lock->un_member.rec_lock.space;
+			ulint	page_no = lock->un_member.rec_lock.page_no;
+			ib_mutex_t*	shard = lock_sys.rec_shard(
+				lock_rec_hash(space, page_no));
+
+			mutex_enter(shard);
+
+			const lock_t*	l = lock_rec_get_first_on_page_addr(
+				lock_sys.rec_hash, space, page_no);
+
+			while (l != NULL && !lock_get_wait(l)) {
+				l = lock_rec_get_next_on_page_const(l);
+			}
+
+			if (l == NULL) {
+				lock->index->table->n_rec_locks--;
+
+				HASH_DELETE(lock_t, hash, lock_sys.rec_hash,
+					    lock_rec_fold(space, page_no),
+					    lock);
+
+				trx_mutex_enter(trx);
+				UT_LIST_REMOVE(trx->lock.trx_locks, lock);
+				trx_mutex_exit(trx);
+
+				MONITOR_ATOMIC_INC(MONITOR_RECLOCK_REMOVED);
+				MONITOR_ATOMIC_DEC(MONITOR_NUM_RECLOCK);
+			}
+
+			mutex_exit(shard);
+			continue;
+		}
+
+		if (lock_get_mode(lock) != LOCK_IS
+		    && lock_get_mode(lock) != LOCK_IX) {
+			continue;
+		}
+
+		dict_table_t*	table = lock->un_member.tab_lock.table;
+		ib_mutex_t*	shard = lock_sys.table_shard(table->id);
+
+		mutex_enter(shard);
+
+		const lock_t*	l = UT_LIST_GET_FIRST(table->locks);
+
+		while (l != NULL && !lock_get_wait(l)) {
+			l = UT_LIST_GET_NEXT(un_member.tab_lock.locks, l);
+		}
+
+		if (l == NULL) {
+			if (lock_get_mode(lock) == LOCK_IX
+			    && trx->undo_no != 0) {
+				/* See lock_release(). */
+				table->query_cache_inv_trx_id = max_trx_id;
+			}
+
+			trx_mutex_enter(trx);
+			UT_LIST_REMOVE(trx->lock.trx_locks, lock);
+			trx_mutex_exit(trx);
+			ut_list_remove(table->locks, lock,
+				       TableLockGetNode());
+
+			MONITOR_ATOMIC_INC(MONITOR_TABLELOCK_REMOVED);
+			MONITOR_ATOMIC_DEC(MONITOR_NUM_TABLELOCK);
+		}
+
+		mutex_exit(shard);
+	}
+
+	rw_lock_s_unlock(&lock_sys.latch);
+}
+
 /** Release the explicit locks of a committing transaction,
 and release possible other transactions waiting because of these locks. */
 void lock_release(trx_t* trx)
@@ -4275,9 +4521,17 @@ void lock_release(trx_t* trx)
 	ulint		count = 0;
 	trx_id_t	max_trx_id = trx_sys.get_max_trx_id();
 
-	lock_mutex_enter();
 	ut_ad(!trx_mutex_own(trx));
 
+	lock_release_try_fast(trx, max_trx_id);
+
+	/* No other thread can add locks to a committing transaction. */
+	if (UT_LIST_GET_LEN(trx->lock.trx_locks) == 0) {
+		return;
+	}
+
+	lock_mutex_enter();
+
 	for (lock_t* lock = UT_LIST_GET_LAST(trx->lock.trx_locks);
 	     lock != NULL;
 	     lock = UT_LIST_GET_LAST(trx->lock.trx_locks)) {
@@ -151,6 +151,34 @@ log_buf_pool_get_oldest_modification(void)
 	return(lsn);
 }
 
+/** Wait until the strings of all log_reserve() calls have been copied
+to the log buffer. Because log_sys.mutex is held, no further space can
+be reserved meanwhile. */
+static
+void
+log_wait_for_copies()
+{
+	ut_ad(log_mutex_own());
+
+	if (!log_sys.n_pending_copies.load(std::memory_order_acquire)) {
+		return;
+	}
+
+	log_sys.copies_waiting.store(true);
+
+	for (;;) {
+		int64_t	sig_count = os_event_reset(log_sys.copies_event);
+
+		if (!log_sys.n_pending_copies.load()) {
+			break;
+		}
+
+		os_event_wait_low(log_sys.copies_event, sig_count);
+	}
+
+	log_sys.copies_waiting.store(false, std::memory_order_relaxed);
+}
+
 /** Extends the log buffer.
 @param[in]	len	requested minimum size in bytes */
 void log_buffer_extend(ulong len)
@@ -173,6 +201,8 @@ void log_buffer_extend(ulong len)
 		" exceeds innodb_log_buffer_size="
 		<< srv_log_buffer_size << " / 2). Trying to extend it.";
 
+	log_wait_for_copies();
+
 	const byte* old_buf_begin = log_sys.buf;
 	const ulong old_buf_size = srv_log_buffer_size;
 	byte* old_buf = log_sys.first_in_use
@@ -323,14 +353,14 @@ log_reserve_and_open(
 	return(log_sys.lsn);
 }
 
-/************************************************************//**
-Writes to the log the string given. It is assumed that the caller holds the
-log mutex. */
+/** Append a string to the log buffer, or reserve space for it.
+@param[in]	str	string, or NULL to only reserve the space
+@param[in]	str_len	string length */
+static
 void
-log_write_low(
-/*==========*/
-	const byte*	str,		/*!< in: string */
-	ulint		str_len)	/*!< in: string length */
+log_append(
+	const byte*	str,
+	ulint		str_len)
 {
 	ulint	len;
 
@@ -353,10 +383,12 @@ log_write_low(
 			- log_sys.buf_free % OS_FILE_LOG_BLOCK_SIZE;
 	}
 
-	memcpy(log_sys.buf + log_sys.buf_free, str, len);
+	if (str) {
+		memcpy(log_sys.buf + log_sys.buf_free, str, len);
+		str += len;
+	}
 
 	str_len -= len;
-	str = str + len;
 
 	byte* log_block = static_cast<byte*>(
 		ut_align_down(log_sys.buf + log_sys.buf_free,
@@ -391,6 +423,85 @@ log_write_low(
 	srv_stats.log_write_requests.inc();
 }
 
+/************************************************************//**
+Writes to the log the string given. It is assumed that the caller holds the
+log mutex. */
+void
+log_write_low(
+/*==========*/
+	const byte*	str,		/*!< in: string */
+	ulint		str_len)	/*!< in: string length */
+{
+	ut_ad(str);
+	log_append(str, str_len);
+}
+
+/** Reserve space in the log buffer for a string, without copying it.
+The caller must hold log_sys.mutex, and must invoke log_close() before
+releasing it. The string must then be copied by log_write_reserved()
+and the reservation released by log_reserve_release(). Until then,
+the log buffer will not be written to the file.
+@param[in]	len		length of the string
+@param[out]	start_lsn	start LSN of the string
+@return	the position of the string in log_sys.buf */
+byte*
+log_reserve(
+	ulint	len,
+	lsn_t*	start_lsn)
+{
+	ut_ad(len > 0);
+
+	*start_lsn = log_reserve_and_open(len);
+
+	byte*	ptr = log_sys.buf + log_sys.buf_free;
+
+	/* The block headers and trailers are written here, under
+	log_sys.mutex. The copying only fills in the payload. */
+	log_append(NULL, len);
+
+	log_sys.n_pending_copies.fetch_add(1, std::memory_order_relaxed);
+
+	return(ptr);
+}
+
+/** Copy a string to space that was reserved by log_reserve(),
+skipping the log block trailers and headers. This does not require
+log_sys.mutex.
+@param[in,out]	ptr	position in log_sys.buf; advanced past the string
+@param[in]	str	string
+@param[in]	len	length of the string */
+void
+log_write_reserved(
+	byte*&		ptr,
+	const byte*	str,
+	ulint		len)
+{
+	ut_ad(log_sys.n_pending_copies.load(std::memory_order_relaxed));
+
+	const ulint	trailer_offset = log_sys.trailer_offset();
+
+	while (len) {
+		ulint	offset = ut_align_offset(ptr, OS_FILE_LOG_BLOCK_SIZE);
+
+		if (offset == trailer_offset) {
+			/* log_append() filled this block and
+			initialized the header of the next one. */
+			ptr += log_sys.framing_size();
+			offset = LOG_BLOCK_HDR_SIZE;
+		}
+
+		ut_ad(offset >= LOG_BLOCK_HDR_SIZE);
+		ut_ad(offset < trailer_offset);
+
+		const ulint	n = std::min(len, trailer_offset - offset);
+
+		memcpy(ptr, str, n);
+		ptr += n;
+		str += n;
+		len -= n;
+	}
+}
+
 /************************************************************//**
 Closes the log.
 @return lsn */
@@ -556,6 +667,9 @@ void log_t::create()
   n_pending_flushes= 0;
   flush_event = os_event_create("log_flush_event");
   os_event_set(flush_event);
+  n_pending_copies.store(0, std::memory_order_relaxed);
+  copies_waiting.store(false, std::memory_order_relaxed);
+  copies_event = os_event_create("log_copies_event");
   n_log_ios= 0;
   n_log_ios_old= 0;
   log_group_capacity= 0;
@@ -949,6 +1063,8 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key)
 		}
 	}
 
+	log_wait_for_copies();
+
 	start_offset = log_sys.buf_next_to_write;
 	end_offset = log_sys.buf_free;
 
@@ -1931,6 +2047,7 @@ void log_t::close()
   buf = NULL;
 
   os_event_destroy(flush_event);
+  os_event_destroy(copies_event);
   rw_lock_free(&checkpoint_lock);
   mutex_free(&mutex);
   mutex_free(&write_mutex);
@@ -1930,11 +1930,6 @@ static void recv_recover_page(buf_block_t* block, mtr_t& mtr,
 		buf_flush_note_modification(block, start_lsn, end_lsn, NULL);
 		log_flush_order_mutex_exit();
 	} else if (free_page && init) {
-		/* There have been no operations than MLOG_INIT_FREE_PAGE.
-		Any buffered changes must not be merged. A subsequent
-		buf_page_create() from a user thread should discard
-		any buffered changes. */
-		init->created = false;
 		ut_ad(!mtr.has_modifications());
 	}
 
@@ -1948,6 +1943,15 @@ static void recv_recover_page(buf_block_t* block, mtr_t& mtr,
 
 	mutex_enter(&recv_sys.mutex);
 
+	if (!start_lsn && free_page && init) {
+		/* There have been no operations than MLOG_INIT_FREE_PAGE.
+		Any buffered changes must not be merged. A subsequent
+		buf_page_create() from a user thread should discard
+		any buffered changes. The other recovery threads read
+		recv_sys.mlog_init under recv_sys.mutex. */
+		init->created = false;
+	}
+
 	if (recv_max_page_lsn < page_lsn) {
 		recv_max_page_lsn = page_lsn;
 	}
@@ -2042,75 +2046,73 @@ static void recv_read_in_area(page_id_t page_id)
 	}
 }
 
-/** Apply recv_sys.pages to persistent data pages.
-@param[in]	last_batch	whether the change buffer merge will be
-				performed as part of the operation */
-void recv_apply_hashed_log_recs(bool last_batch)
-{
-	ut_ad(srv_operation == SRV_OPERATION_NORMAL
-	      || srv_operation == SRV_OPERATION_RESTORE
-	      || srv_operation == SRV_OPERATION_RESTORE_EXPORT);
+/** A key range of recv_sys.pages that is processed by one thread of
+recv_apply_hashed_log_recs() */
+struct recv_apply_thr_t {
+	/** first page of the range */
+	page_id_t	first;
+	/** end of the range (exclusive), unless last */
+	page_id_t	end;
+	/** whether this is the last range, extending to the end of the map */
+	bool		last;
+	/** thread handle */
+	os_thread_t	handle;
+
+	recv_apply_thr_t() : first(0, 0), end(0, 0), last(true) {}
+
+	/** @return whether a page belongs to the range */
+	bool contains(const page_id_t page_id) const
+	{
+		return !(page_id < first) && (last || page_id < end);
+	}
+};
 
-	mutex_enter(&recv_sys.mutex);
+/** Split recv_sys.pages into disjoint key ranges of roughly the same
+number of pages. Each range starts at a read-ahead area boundary, so that
+a recv_read_in_area() request stays within one range.
+@param[out]	thr		ranges
+@param[in]	n_threads	maximum number of ranges
+@return	number of ranges */
+static ulint recv_apply_partition(recv_apply_thr_t* thr, ulint n_threads)
+{
+	ut_ad(mutex_own(&recv_sys.mutex));
 
-	while (recv_sys.apply_batch_on) {
-		bool abort = recv_sys.found_corrupt_log;
-		mutex_exit(&recv_sys.mutex);
+	const ulint	per_thread = recv_sys.pages.size() / n_threads;
+	ulint		i = 0, n = 0;
 
-		if (abort) {
-			return;
+	for (recv_sys_t::map::const_iterator p = recv_sys.pages.begin();
+	     p != recv_sys.pages.end() && i + 1 < n_threads; p++) {
+		if (++n <= per_thread) {
+			continue;
 		}
 
-		os_thread_sleep(500000);
-		mutex_enter(&recv_sys.mutex);
+		page_id_t bound(p->first.space(),
+				ut_2pow_round(p->first.page_no(),
+					      RECV_READ_AHEAD_AREA));
+		if (thr[i].first < bound) {
+			thr[i].end = bound;
+			thr[i].last = false;
+			thr[++i].first = bound;
+			n = 1;
+		}
 	}
 
-	ut_ad(!last_batch == log_mutex_own());
-
-	recv_no_ibuf_operations = !last_batch
-		|| srv_operation == SRV_OPERATION_RESTORE
-		|| srv_operation == SRV_OPERATION_RESTORE_EXPORT;
+	return i + 1;
+}
 
-	ut_d(recv_no_log_write = recv_no_ibuf_operations);
+/** Apply the log to those pages of recv_sys.pages that belong to a range.
+Pages that are not in the buffer pool are submitted for reading, and
+the log will be applied to them in buf_page_io_complete().
+@param[in]	thr	range to process */
+static void recv_apply_range(const recv_apply_thr_t& thr)
+{
+	ut_ad(mutex_own(&recv_sys.mutex));
 
 	mtr_t mtr;
 
-	if (recv_sys.pages.empty()) {
-		goto done;
-	}
-
-	if (!log_sys.log.subformat && !srv_force_recovery
-	    && srv_undo_tablespaces_open) {
-		ib::error() << "Recovery of separately logged"
-			" TRUNCATE operations is no longer supported."
-			" Set innodb_force_recovery=1"
-			" if no *trunc.log files exist";
-		recv_sys.found_corrupt_log = true;
-		mutex_exit(&recv_sys.mutex);
-		return;
-	} else {
-		const char* msg = last_batch
-			? "Starting final batch to recover "
-			: "Starting a batch to recover ";
-		const ulint n = recv_sys.pages.size();
-		ib::info() << msg << n << " pages from redo log.";
-		sd_notifyf(0, "STATUS=%s" ULINTPF " pages from redo log",
-			   msg, n);
-	}
-
-	recv_sys.apply_log_recs = true;
-	recv_sys.apply_batch_on = true;
-
-	for (ulint id = srv_undo_tablespaces_open; id--;) {
-		const recv_sys_t::trunc& t= recv_sys.truncated_undo_spaces[id];
-		if (t.lsn) {
-			recv_sys.trim(page_id_t(id + srv_undo_space_id_start,
-						t.pages), t.lsn);
-		}
-	}
-
-	for (recv_sys_t::map::iterator p = recv_sys.pages.begin();
-	     p != recv_sys.pages.end();) {
+	for (recv_sys_t::map::iterator p = recv_sys.pages.lower_bound(
+		     thr.first);
+	     p != recv_sys.pages.end() && thr.contains(p->first);) {
 		const page_id_t page_id = p->first;
 		recv_sys_t::recs_t& recs = p->second;
 		ut_ad(recs.log);
@@ -2216,6 +2218,123 @@ void recv_apply_hashed_log_recs(bool last_batch)
 		p = recv_sys.pages.lower_bound(page_id);
 	}
 
+}
+
+/** Thread that applies the log to a range of recv_sys.pages.
+@param[in]	arg	recv_apply_thr_t
+@return OS_THREAD_DUMMY_RETURN */
+static
+os_thread_ret_t
+DECLARE_THREAD(recv_apply_thread)(void* arg)
+{
+	const recv_apply_thr_t* thr = static_cast<recv_apply_thr_t*>(arg);
+
+	mutex_enter(&recv_sys.mutex);
+	recv_apply_range(*thr);
+	mutex_exit(&recv_sys.mutex);
+
+	os_thread_exit(false);
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
+/** Apply recv_sys.pages to persistent data pages.
+@param[in]	last_batch	whether the change buffer merge will be
+				performed as part of the operation */
+void recv_apply_hashed_log_recs(bool last_batch)
+{
+	ut_ad(srv_operation == SRV_OPERATION_NORMAL
+	      || srv_operation == SRV_OPERATION_RESTORE
+	      || srv_operation == SRV_OPERATION_RESTORE_EXPORT);
+
+	mutex_enter(&recv_sys.mutex);
+
+	while (recv_sys.apply_batch_on) {
+		bool abort = recv_sys.found_corrupt_log;
+		mutex_exit(&recv_sys.mutex);
+
+		if (abort) {
+			return;
+		}
+
+		os_thread_sleep(500000);
+		mutex_enter(&recv_sys.mutex);
+	}
+
+	ut_ad(!last_batch == log_mutex_own());
+
+	recv_no_ibuf_operations = !last_batch
+		|| srv_operation == SRV_OPERATION_RESTORE
+		|| srv_operation == SRV_OPERATION_RESTORE_EXPORT;
+
+	ut_d(recv_no_log_write = recv_no_ibuf_operations);
+
+	mtr_t mtr;
+	ulint n_threads;
+
+	if (recv_sys.pages.empty()) {
+		goto done;
+	}
+
+	if (!log_sys.log.subformat && !srv_force_recovery
+	    && srv_undo_tablespaces_open) {
+		ib::error() << "Recovery of separately logged"
+			" TRUNCATE operations is no longer supported."
+			" Set innodb_force_recovery=1"
+			" if no *trunc.log files exist";
+		recv_sys.found_corrupt_log = true;
+		mutex_exit(&recv_sys.mutex);
+		return;
+	} else {
+		const char* msg = last_batch
+			? "Starting final batch to recover "
+			: "Starting a batch to recover ";
+		const ulint n = recv_sys.pages.size();
+		ib::info() << msg << n << " pages from redo log.";
+		sd_notifyf(0, "STATUS=%s" ULINTPF " pages from redo log",
+			   msg, n);
+	}
+
+	recv_sys.apply_log_recs = true;
+	recv_sys.apply_batch_on = true;
+
+	for (ulint id = srv_undo_tablespaces_open; id--;) {
+		const recv_sys_t::trunc& t= recv_sys.truncated_undo_spaces[id];
+		if (t.lsn) {
+			recv_sys.trim(page_id_t(id + srv_undo_space_id_start,
+						t.pages), t.lsn);
+		}
+	}
+
+	n_threads = std::min<ulint>(srv_n_recovery_threads,
+				    recv_sys.pages.size());
+
+	if (n_threads > 1) {
+		recv_apply_thr_t* thr = UT_NEW_ARRAY_NOKEY(recv_apply_thr_t,
+							   n_threads);
+
+		n_threads = recv_apply_partition(thr, n_threads);
+
+		for (ulint i = 1; i < n_threads; i++) {
+			thr[i].handle = os_thread_create(
+				recv_apply_thread, &thr[i], NULL);
+		}
+
+		/* The calling thread processes the first range. */
+		recv_apply_range(thr[0]);
+
+		mutex_exit(&recv_sys.mutex);
+
+		for (ulint i = 1; i < n_threads; i++) {
+			os_thread_join(thr[i].handle);
+		}
+
+		UT_DELETE_ARRAY(thr);
+		mutex_enter(&recv_sys.mutex);
+	} else {
+		recv_apply_range(recv_apply_thr_t());
+	}
+
 	/* Wait until all the pages have been processed */
 
 	while (!recv_sys.pages.empty()) {
@@ -468,6 +468,24 @@ struct mtr_write_log_t {
 	}
 };
 
+/** Copy the block contents to space reserved in the redo log buffer */
+struct mtr_copy_log_t {
+	/** Constructor.
+	@param[in,out]	ptr	position returned by log_reserve() */
+	explicit mtr_copy_log_t(byte*& ptr) : m_ptr(ptr) {}
+
+	/** Copy a block to the redo log buffer.
+	@return whether the copying should continue */
+	bool operator()(const mtr_buf_t::block_t* block) const
+	{
+		log_write_reserved(m_ptr, block->begin(), block->used());
+		return(true);
+	}
+
+	/** position in log_sys.buf */
+	byte*&	m_ptr;
+};
+
 /** Append records to the system-wide redo log buffer.
 @param[in]	log	redo log records */
 void
@@ -892,8 +910,17 @@ mtr_t::Command::execute()
 {
 	ut_ad(m_impl->m_log_mode != MTR_LOG_NONE);
 
+	byte*	log_ptr = NULL;
+
 	if (const ulint len = prepare_write()) {
+#ifdef UNIV_LOG_LSN_DEBUG
 		finish_write(len);
+#else
+		/* Only reserve the space while holding log_sys.mutex.
+		The records are copied after the mutex has been released. */
+		log_ptr = log_reserve(len, &m_start_lsn);
+		m_end_lsn = log_close();
+#endif /* UNIV_LOG_LSN_DEBUG */
 	}
 
 	if (m_impl->m_made_dirty) {
@@ -913,6 +940,14 @@ mtr_t::Command::execute()
 		log_flush_order_mutex_exit();
 	}
 
+	if (log_ptr) {
+		/* The log buffer will not be written to the file
+		before all reservations have been released. */
+		mtr_copy_log_t	copy_log(log_ptr);
+		m_impl->m_log.for_each_block(copy_log);
+		log_reserve_release();
+	}
+
 	release_latches();
 
 	release_resources();
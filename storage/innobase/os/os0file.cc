@@ -58,6 +58,27 @@ Created 10/21/1995 Heikki Tuuri
 #include <libaio.h>
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <algorithm>
+
+# ifndef IORING_REGISTER_CLONE_BUFFERS
+/* Linux 6.12 and later; older kernels reject it with EINVAL. */
+#  define IORING_REGISTER_CLONE_BUFFERS 30
+struct io_uring_clone_buffers {
+	__u32	src_fd;
+	__u32	flags;
+	__u32	src_off;
+	__u32	dst_off;
+	__u32	nr;
+	__u32	pad[3];
+};
+# endif
+#endif /* HAVE_IO_URING */
+
 #ifdef HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE
 # include <fcntl.h>
 # include <linux/falloc.h>
@@ -272,6 +293,156 @@ struct Slot {
 
 };
 
+#ifdef HAVE_IO_URING
+/** An io_uring instance for one segment of an AIO array. Requests are
+added to the submission queue under AIO::m_mutex, and the completion
+queue is only consumed by the I/O handler thread of the segment. */
+struct IOUring {
+	/** Create the rings.
+	@param[in]	entries	minimum number of submission queue entries
+	@return 0 or negative errno */
+	int create(unsigned entries);
+
+	/** Unmap the rings and close the file descriptor */
+	void destroy();
+
+	/** @return a cleared submission queue entry, or NULL if full */
+	io_uring_sqe* get_sqe()
+	{
+		unsigned	tail = *sq_tail;
+
+		if (tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE)
+		    >= sq_entries) {
+			return(NULL);
+		}
+
+		unsigned	i = tail & sq_mask;
+		sq_array[i] = i;
+		memset(&sqes[i], 0, sizeof sqes[i]);
+		return(&sqes[i]);
+	}
+
+	/** Pass the entry filled in after get_sqe() to the kernel on
+	the next submit() */
+	void queue()
+	{
+		__atomic_store_n(sq_tail, *sq_tail + 1, __ATOMIC_RELEASE);
+		n_queued++;
+	}
+
+	/** Submit all queued entries. If the kernel is short of
+	resources, the entries stay queued for the I/O handler thread. */
+	void submit();
+
+	/** Wait for at least one completion.
+	@param[in]	timeout_ns	timeout in nanoseconds
+	@return 0 or negative errno */
+	int wait(ulint timeout_ns);
+
+	/** @return the oldest completion that was not reaped, or NULL */
+	const io_uring_cqe* peek_cqe() const
+	{
+		unsigned	head = *cq_head;
+
+		if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+			return(NULL);
+		}
+
+		return(&cqes[head & cq_mask]);
+	}
+
+	/** Release the completion returned by peek_cqe() */
+	void cqe_seen()
+	{
+		__atomic_store_n(cq_head, *cq_head + 1, __ATOMIC_RELEASE);
+	}
+
+	/** Register buffers for IORING_OP_READ_FIXED, IORING_OP_WRITE_FIXED.
+	@param[in]	iov	memory regions
+	@param[in]	n	number of regions
+	@return 0 or negative errno */
+	int register_buffers(const iovec* iov, unsigned n)
+	{
+		return(syscall(__NR_io_uring_register, fd,
+			       IORING_REGISTER_BUFFERS, iov, n) < 0
+		       ? -errno : 0);
+	}
+
+	/** Share the buffers that are registered with another ring,
+	without pinning and accounting them again.
+	@param[in]	src	ring whose buffers to share
+	@return 0 or negative errno */
+	int clone_buffers(const IOUring& src)
+	{
+		io_uring_clone_buffers	arg;
+
+		memset(&arg, 0, sizeof arg);
+		arg.src_fd = __u32(src.fd);
+
+		return(syscall(__NR_io_uring_register, fd,
+			       IORING_REGISTER_CLONE_BUFFERS, &arg, 1) < 0
+		       ? -errno : 0);
+	}
+
+	/** Unregister the buffers */
+	void unregister_buffers()
+	{
+		syscall(__NR_io_uring_register, fd,
+			IORING_UNREGISTER_BUFFERS, NULL, 0);
+	}
+
+	/** Make the entries that were queued but not submitted yet use
+	plain reads and writes, so that they remain valid after the
+	buffers are unregistered. The kernel only consumes entries in
+	submit(), which is protected by the same mutex as this. */
+	void unfix_queued()
+	{
+		for (unsigned i = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+		     i != *sq_tail; i++) {
+			io_uring_sqe&	sqe = sqes[sq_array[i & sq_mask]];
+
+			switch (sqe.opcode) {
+			case IORING_OP_READ_FIXED:
+				sqe.opcode = IORING_OP_READ;
+				break;
+			case IORING_OP_WRITE_FIXED:
+				sqe.opcode = IORING_OP_WRITE;
+				break;
+			}
+
+			sqe.buf_index = 0;
+		}
+	}
+
+	/** file descriptor of the ring, or -1 */
+	int		fd;
+	/** whether buffers are registered with the ring */
+	bool		fixed;
+	/** number of entries that were queued but not submitted */
+	unsigned	n_queued;
+
+	/** submission queue */
+	unsigned*	sq_head;
+	unsigned*	sq_tail;
+	unsigned*	sq_array;
+	unsigned	sq_mask;
+	unsigned	sq_entries;
+	io_uring_sqe*	sqes;
+
+	/** completion queue */
+	unsigned*	cq_head;
+	unsigned*	cq_tail;
+	unsigned	cq_mask;
+	io_uring_cqe*	cqes;
+
+	/** mapping of the submission and completion queue rings */
+	void*		ring_ptr;
+	size_t		ring_size;
+	/** size of the mapping of sqes */
+	size_t		sqes_size;
+};
+#endif /* HAVE_IO_URING */
+
 /** The asynchronous i/o array structure */
 class AIO {
 public:
@@ -433,6 +604,39 @@ class AIO {
 		MY_ATTRIBUTE((warn_unused_result));
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_IO_URING
+	/** Accessor for the io_uring instance of a segment
+	@param[in]	segment	local segment
+	@return the io_uring instance, or NULL if libaio is used */
+	IOUring* uring(ulint segment)
+	{
+		ut_ad(segment < get_n_segments());
+
+		return(m_uring ? &m_uring[segment] : NULL);
+	}
+
+	/** Add a request to the io_uring submission queue of its segment.
+	@param[in,out]	slot	an already reserved slot
+	@param[in]	submit	whether to submit the queue right away */
+	void uring_queue(Slot* slot, bool submit);
+
+	/** Submit the io_uring requests that were queued with
+	IORequest::DO_NOT_WAKE. */
+	static void uring_submit_all();
+
+	/** Register memory regions as io_uring fixed buffers, replacing
+	any earlier registration.
+	@param[in]	iov	memory regions, sorted by address
+	@param[in]	n	number of regions; 0 unregisters */
+	static void uring_register_all(const iovec* iov, ulint n);
+
+	/** Checks if the kernel supports everything that we need
+	from io_uring.
+	@return true if supported, false otherwise. */
+	static bool is_io_uring_supported()
+		MY_ATTRIBUTE((warn_unused_result));
+#endif /* HAVE_IO_URING */
+
 #ifdef WIN_ASYNC_IO
 	HANDLE m_completion_port;
 	/** Wake up all AIO threads in Windows native aio */
@@ -584,6 +788,26 @@ class AIO {
 		MY_ATTRIBUTE((warn_unused_result));
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_IO_URING
+	/** Create the io_uring instances, one for each segment
+	@return DB_SUCCESS or DB_ERROR */
+	dberr_t init_io_uring()
+		MY_ATTRIBUTE((warn_unused_result));
+
+	/** Unregister the fixed buffers of the io_uring instances of
+	this array. Requests that are queued but not submitted are
+	changed to plain reads and writes. */
+	void uring_unregister();
+
+	/** Register memory regions as fixed buffers with the io_uring
+	instances of this array.
+	@param[in]	iov	memory regions, sorted by address
+	@param[in]	n	number of regions
+	@param[in,out]	owner	the ring that the regions are registered
+	with, or NULL to register them with the first ring of this array */
+	void uring_register(const iovec* iov, ulint n, IOUring*& owner);
+#endif /* HAVE_IO_URING */
+
 private:
 	typedef std::vector<Slot> Slots;
 
@@ -626,6 +850,15 @@ class AIO {
 	IOEvents		m_events;
 #endif /* LINUX_NATIV_AIO */
 
+#ifdef HAVE_IO_URING
+	/** io_uring instances, one per segment, or NULL if libaio
+	is used instead */
+	IOUring*		m_uring;
+
+	/** Buffers that are registered with m_uring, sorted by address */
+	std::vector<iovec>	m_fixed_bufs;
+#endif /* HAVE_IO_URING */
+
 	/** The aio arrays for non-ibuf i/o and ibuf i/o, as well as
 	sync AIO. These are NULL when the module has not yet been
 	initialized. */
@@ -664,6 +897,30 @@ static const ulint	OS_AIO_IO_SETUP_RETRY_SLEEP = 500000UL;
 static const int	OS_AIO_IO_SETUP_RETRY_ATTEMPTS = 5;
 #endif /* LINUX_NATIVE_AIO */
 
+#ifdef HAVE_IO_URING
+/** Whether io_uring is used instead of libaio */
+static bool		os_aio_use_io_uring;
+
+/** Order a pointer and a registered buffer by address.
+@param[in]	ptr	pointer
+@param[in]	iov	registered buffer
+@return whether ptr is below iov */
+static bool os_aio_iov_less(const byte* ptr, const iovec& iov)
+{
+	return(ptr < static_cast<const byte*>(iov.iov_base));
+}
+
+/** Order registered buffers by address.
+@param[in]	a	registered buffer
+@param[in]	b	registered buffer
+@return whether a is below b */
+static bool os_aio_iov_cmp(const iovec& a, const iovec& b)
+{
+	return(static_cast<const byte*>(a.iov_base)
+	       < static_cast<const byte*>(b.iov_base));
+}
+#endif /* HAVE_IO_URING */
+
 /** Array of events used in simulated AIO */
 static os_event_t*	os_aio_segment_wait_events;
 
@@ -1600,6 +1857,19 @@ class LinuxAIOHandler {
 	each wakeup and that is why we use timed wait in io_getevents(). */
 	void collect();
 
+#ifdef HAVE_IO_URING
+	/** Like collect(), but reap the completions of an io_uring
+	instance. Before waiting, submit the requests that were queued
+	with IORequest::DO_NOT_WAKE and not submitted since.
+	@param[in,out]	ring	io_uring instance of the segment */
+	void collect(IOUring* ring);
+#endif /* HAVE_IO_URING */
+
+	/** Mark a request completed.
+	@param[in,out]	slot	the request
+	@param[in]	res	number of bytes transferred, or negated errno */
+	void complete(Slot* slot, ulint res);
+
 private:
 	/** Slot array */
 	AIO*			m_array;
@@ -1666,6 +1936,13 @@ LinuxAIOHandler::resubmit(Slot* slot)
 
 	iocb->data = slot;
 
+#ifdef HAVE_IO_URING
+	if (m_array->uring(m_segment)) {
+		m_array->uring_queue(slot, true);
+		return(DB_SUCCESS);
+	}
+#endif /* HAVE_IO_URING */
+
 	/* Resubmit an I/O request */
 	int	ret = io_submit(m_array->io_ctx(m_segment), 1, &iocb);
 	srv_stats.buffered_aio_submitted.inc();
@@ -1771,6 +2048,13 @@ LinuxAIOHandler::collect()
 	ut_ad(m_array != NULL);
 	ut_ad(m_segment < m_array->get_n_segments());
 
+#ifdef HAVE_IO_URING
+	if (IOUring* ring = m_array->uring(m_segment)) {
+		collect(ring);
+		return;
+	}
+#endif /* HAVE_IO_URING */
+
 	/* Which io_context we are going to use. */
 	io_context*	io_ctx = m_array->io_ctx(m_segment);
 
@@ -1819,43 +2103,14 @@ LinuxAIOHandler::collect()
 			/* We have not overstepped to next segment. */
 			ut_a(slot->pos < end_pos);
 
-			/* Deallocate unused blocks from file system.
-			This is newer done to page 0 or to log files.*/
-			if (slot->offset > 0
-			    && !slot->type.is_log()
-			    && slot->type.is_write()
-			    && slot->type.punch_hole()) {
-
-				slot->err = slot->type.punch_hole(
-					slot->file,
-					slot->offset, slot->len);
-			} else {
-				slot->err = DB_SUCCESS;
-			}
-
-			/* Mark this request as completed. The error handling
-			will be done in the calling function. */
-			m_array->acquire();
-
 			/* events[i].res2 should always be ZERO */
 			ut_ad(events[i].res2 == 0);
-			slot->io_already_done = true;
 
 			/*Even though events[i].res is an unsigned number
 			in libaio, it is used to return a negative value
 			(negated errno value) to indicate error and a positive
 			value to indicate number of bytes read or written. */
-
-			if (events[i].res > slot->len) {
-				/* failure */
-				slot->n_bytes = 0;
-				slot->ret = events[i].res;
-			} else {
-				/* success */
-				slot->n_bytes = events[i].res;
-				slot->ret = 0;
-			}
-			m_array->release();
+			complete(slot, events[i].res);
 		}
 
 		if (srv_shutdown_state == SRV_SHUTDOWN_EXIT_THREADS
@@ -1895,6 +2150,107 @@ LinuxAIOHandler::collect()
 	}
 }
 
+#ifdef HAVE_IO_URING
+/** Like collect(), but reap the completions of an io_uring instance.
+Before waiting, submit the requests that were queued with
+IORequest::DO_NOT_WAKE and not submitted since.
+@param[in,out]	ring	io_uring instance of the segment */
+void
+LinuxAIOHandler::collect(IOUring* ring)
+{
+	ulint	start_pos = m_segment * m_n_slots;
+	ulint	end_pos = start_pos + m_n_slots;
+
+	for (;;) {
+		if (ring->n_queued) {
+			m_array->acquire();
+			ring->submit();
+			m_array->release();
+		}
+
+		int	ret = ring->wait(OS_AIO_REAP_TIMEOUT);
+		ulint	n_reaped = 0;
+
+		while (const io_uring_cqe* cqe = ring->peek_cqe()) {
+			Slot*	slot = reinterpret_cast<Slot*>(cqe->user_data);
+			/* A negative res (negated errno) becomes a huge
+			unsigned value, just like with libaio. */
+			ulint	res = ulint(ssize_t(cqe->res));
+
+			ring->cqe_seen();
+
+			ut_a(slot != NULL);
+			ut_a(slot->is_reserved);
+			ut_a(slot->pos >= start_pos);
+			ut_a(slot->pos < end_pos);
+
+			complete(slot, res);
+			++n_reaped;
+		}
+
+		if (srv_shutdown_state == SRV_SHUTDOWN_EXIT_THREADS
+		    || !buf_page_cleaner_is_active
+		    || n_reaped > 0) {
+
+			break;
+		}
+
+		switch (ret) {
+		case -ETIME:
+			/* Timed out; check the server state again. */
+		case -EINTR:
+		case -EAGAIN:
+		case -EBUSY:
+		case 0:
+			continue;
+		}
+
+		ib::fatal()
+			<< "Unexpected error " << -ret
+			<< " from io_uring_enter()!";
+	}
+}
+#endif /* HAVE_IO_URING */
+
+/** Mark a request completed.
+@param[in,out]	slot	the request
+@param[in]	res	number of bytes transferred, or negated errno */
+void
+LinuxAIOHandler::complete(Slot* slot, ulint res)
+{
+	/* Deallocate unused blocks from file system.
+	This is newer done to page 0 or to log files.*/
+	if (slot->offset > 0
+	    && !slot->type.is_log()
+	    && slot->type.is_write()
+	    && slot->type.punch_hole()) {
+
+		slot->err = slot->type.punch_hole(
+			slot->file,
+			slot->offset, slot->len);
+	} else {
+		slot->err = DB_SUCCESS;
+	}
+
+	/* Mark this request as completed. The error handling
+	will be done in the calling function. */
+	m_array->acquire();
+
+	slot->io_already_done = true;
+
+	if (res > slot->len) {
+		/* failure */
+		slot->n_bytes = 0;
+		slot->ret = int(res);
+	} else {
+		/* success */
+		slot->n_bytes = ssize_t(res);
+		slot->ret = 0;
+	}
+
+	m_array->release();
+}
+
 /** Process a Linux AIO request
 @param[out]	m1		the messages passed with the
 @param[out]	m2		AIO request; note that in case the
@@ -2027,6 +2383,15 @@ AIO::linux_dispatch(Slot* slot)
 	The iocb struct is directly in the slot.
 	The io_context is one per segment. */
 
+#ifdef HAVE_IO_URING
+	if (m_uring) {
+		acquire();
+		uring_queue(slot, slot->type.is_wake());
+		release();
+		return(true);
+	}
+#endif /* HAVE_IO_URING */
+
 	ulint		io_ctx_index;
 	struct iocb*	iocb = &slot->control;
 
@@ -2045,6 +2410,385 @@ AIO::linux_dispatch(Slot* slot)
 	return(ret == 1);
 }
 
+#ifdef HAVE_IO_URING
+/** Create the rings.
+@param[in]	entries	minimum number of submission queue entries
+@return 0 or negative errno */
+int
+IOUring::create(unsigned entries)
+{
+	io_uring_params	params;
+
+	memset(this, 0, sizeof *this);
+	memset(&params, 0, sizeof params);
+
+	fd = int(syscall(__NR_io_uring_setup, entries, &params));
+
+	if (fd < 0) {
+		fd = -1;
+		return(-errno);
+	}
+
+	/* The I/O handler threads wait with a timeout, which requires
+	IORING_ENTER_EXT_ARG (Linux 5.11). Any such kernel maps both
+	rings with a single mmap(). */
+	if (!(params.features & IORING_FEAT_EXT_ARG)
+	    || !(params.features & IORING_FEAT_SINGLE_MMAP)) {
+		destroy();
+		return(-ENOSYS);
+	}
+
+	ring_size = std::max(
+		params.sq_off.array + params.sq_entries * sizeof(unsigned),
+		params.cq_off.cqes
+		+ params.cq_entries * sizeof(io_uring_cqe));
+	sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+
+	ring_ptr = mmap(NULL, ring_size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+
+	if (ring_ptr == MAP_FAILED) {
+		int	err = errno;
+		ring_ptr = NULL;
+		destroy();
+		return(-err);
+	}
+
+	void*	ptr = mmap(NULL, sqes_size, PROT_READ | PROT_WRITE,
+			   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+
+	if (ptr == MAP_FAILED) {
+		int	err = errno;
+		destroy();
+		return(-err);
+	}
+
+	byte*	ring = static_cast<byte*>(ring_ptr);
+
+	sqes = static_cast<io_uring_sqe*>(ptr);
+	sq_head = reinterpret_cast<unsigned*>(ring + params.sq_off.head);
+	sq_tail = reinterpret_cast<unsigned*>(ring + params.sq_off.tail);
+	sq_array = reinterpret_cast<unsigned*>(ring + params.sq_off.array);
+	sq_mask = *reinterpret_cast<unsigned*>(
+		ring + params.sq_off.ring_mask);
+	sq_entries = params.sq_entries;
+
+	cq_head = reinterpret_cast<unsigned*>(ring + params.cq_off.head);
+	cq_tail = reinterpret_cast<unsigned*>(ring + params.cq_off.tail);
+	cq_mask = *reinterpret_cast<unsigned*>(
+		ring + params.cq_off.ring_mask);
+	cqes = reinterpret_cast<io_uring_cqe*>(ring + params.cq_off.cqes);
+
+	return(0);
+}
+
+/** Unmap the rings and close the file descriptor */
+void
+IOUring::destroy()
+{
+	if (sqes) {
+		munmap(sqes, sqes_size);
+		sqes = NULL;
+	}
+
+	if (ring_ptr) {
+		munmap(ring_ptr, ring_size);
+		ring_ptr = NULL;
+	}
+
+	if (fd >= 0) {
+		close(fd);
+		fd = -1;
+	}
+}
+
+/** Submit all queued entries. If the kernel is short of resources,
+the entries stay queued for the I/O handler thread. */
+void
+IOUring::submit()
+{
+	while (n_queued) {
+		int	ret = int(syscall(__NR_io_uring_enter, fd, n_queued,
+					  0, 0, NULL, 0));
+
+		if (ret > 0) {
+			ut_ad(unsigned(ret) <= n_queued);
+			n_queued -= unsigned(ret);
+			continue;
+		}
+
+		switch (ret < 0 ? errno : EAGAIN) {
+		case EAGAIN:
+		case EBUSY:
+		case EINTR:
+			/* The entries are still in the submission queue;
+			LinuxAIOHandler::collect() will try again. */
+			return;
+		}
+
+		/* The entries were already handed over to the
+		submission queue, and it is too late to fail the
+		requests one by one. */
+		ib::fatal() << "io_uring_enter() failed with error "
+			<< errno;
+	}
+}
+
+/** Wait for at least one completion.
+@param[in]	timeout_ns	timeout in nanoseconds
+@return 0 or negative errno */
+int
+IOUring::wait(ulint timeout_ns)
+{
+	__kernel_timespec	ts;
+	io_uring_getevents_arg	arg;
+
+	ts.tv_sec = timeout_ns / 1000000000;
+	ts.tv_nsec = timeout_ns % 1000000000;
+
+	memset(&arg, 0, sizeof arg);
+	arg.ts = reinterpret_cast<uintptr_t>(&ts);
+
+	return(syscall(__NR_io_uring_enter, fd, 0, 1,
+		       IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+		       &arg, sizeof arg) < 0
+	       ? -errno : 0);
+}
+
+/** Add a request to the io_uring submission queue of its segment.
+@param[in,out]	slot	an already reserved slot
+@param[in]	submit	whether to submit the queue right away */
+void
+AIO::uring_queue(Slot* slot, bool submit)
+{
+	ut_ad(is_mutex_owned());
+	ut_a(slot->is_reserved);
+	ut_ad(slot->type.validate());
+
+	IOUring&	ring = m_uring[(slot->pos * m_n_segments)
+				       / m_slots.size()];
+	io_uring_sqe*	sqe = ring.get_sqe();
+
+	/* A slot has at most one request in the ring at a time, and
+	the ring has at least as many entries as the segment has slots. */
+	ut_a(sqe != NULL);
+
+	const bool	read = slot->type.is_read();
+
+	sqe->opcode = read ? IORING_OP_READ : IORING_OP_WRITE;
+	sqe->fd = slot->file;
+	sqe->off = slot->offset;
+	sqe->addr = reinterpret_cast<uintptr_t>(slot->ptr);
+	sqe->len = uint32_t(slot->len);
+	sqe->user_data = reinterpret_cast<uintptr_t>(slot);
+
+	/* Buffer pool pages are in registered buffers, which spares
+	the kernel from mapping the pages of each request. */
+	std::vector<iovec>::const_iterator	it = std::upper_bound(
+		m_fixed_bufs.begin(), m_fixed_bufs.end(), slot->ptr,
+		os_aio_iov_less);
+
+	if (ring.fixed
+	    && it != m_fixed_bufs.begin()
+	    && slot->ptr + slot->len
+	    <= static_cast<byte*>((--it)->iov_base) + it->iov_len) {
+		sqe->opcode = read
+			? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+		sqe->buf_index = uint16_t(it - m_fixed_bufs.begin());
+	}
+
+	ring.queue();
+	srv_stats.buffered_aio_submitted.inc();
+
+	if (submit) {
+		ring.submit();
+	}
+}
+
+/** Submit the io_uring requests that were queued with
+IORequest::DO_NOT_WAKE. */
+void
+AIO::uring_submit_all()
+{
+	AIO*	arrays[] = { s_reads, s_writes, s_ibuf, s_log };
+
+	for (ulint i = 0; i < array_elements(arrays); i++) {
+		AIO*	array = arrays[i];
+
+		if (!array || !array->m_uring) {
+			continue;
+		}
+
+		array->acquire();
+
+		for (ulint j = 0; j < array->m_n_segments; j++) {
+			array->m_uring[j].submit();
+		}
+
+		array->release();
+	}
+}
+
+/** Unregister the fixed buffers of the io_uring instances of this array.
+Requests that are queued but not submitted are changed to plain reads
+and writes. */
+void
+AIO::uring_unregister()
+{
+	if (!m_uring) {
+		return;
+	}
+
+	acquire();
+
+	for (ulint i = 0; i < m_n_segments; i++) {
+		IOUring&	ring = m_uring[i];
+
+		if (ring.fixed) {
+			/* Submitted requests keep a reference to the
+			buffers, but queued ones would fail with EFAULT
+			or use a different buffer with the same index. */
+			ring.unfix_queued();
+			ring.unregister_buffers();
+			ring.fixed = false;
+		}
+	}
+
+	m_fixed_bufs.clear();
+
+	release();
+}
+
+/** Register memory regions as fixed buffers with the io_uring instances
+of this array.
+@param[in]	iov	memory regions, sorted by address
+@param[in]	n	number of regions
+@param[in,out]	owner	the ring that the regions are registered with,
+or NULL to register them with the first ring of this array */
+void
+AIO::uring_register(const iovec* iov, ulint n, IOUring*& owner)
+{
+	if (!m_uring) {
+		return;
+	}
+
+	acquire();
+
+	ulint	i = 0;
+
+	if (owner == NULL) {
+		/* The pages are locked in memory while registered,
+		and this may exceed RLIMIT_MEMLOCK. */
+		if (int err = m_uring[0].register_buffers(
+			    iov, unsigned(n))) {
+			ib::warn() << "Could not register the buffer pool"
+				" with io_uring: error " << -err;
+			release();
+			return;
+		}
+
+		owner = &m_uring[0];
+		owner->fixed = true;
+		i = 1;
+	}
+
+	/* Registering the buffers with every ring would pin and
+	account them once per ring. If the kernel cannot share them,
+	only the rings that already have them use fixed buffers. */
+	for (; i < m_n_segments; i++) {
+		if (m_uring[i].clone_buffers(*owner)) {
+			break;
+		}
+
+		m_uring[i].fixed = true;
+	}
+
+	m_fixed_bufs.assign(iov, iov + n);
+
+	release();
+}
+
+/** Register memory regions as io_uring fixed buffers, replacing any
+earlier registration.
+@param[in]	iov	memory regions, sorted by address
+@param[in]	n	number of regions; 0 unregisters */
+void
+AIO::uring_register_all(const iovec* iov, ulint n)
+{
+	/* Log writes do not use the buffer pool. */
+	AIO*	arrays[] = { s_reads, s_writes, s_ibuf };
+
+	/* Release all earlier registrations first, so that the old and
+	the new regions are never pinned at the same time. */
+	for (ulint i = 0; i < array_elements(arrays); i++) {
+		if (arrays[i]) {
+			arrays[i]->uring_unregister();
+		}
+	}
+
+	IOUring*	owner = NULL;
+
+	for (ulint i = 0; n && i < array_elements(arrays); i++) {
+		if (arrays[i]) {
+			arrays[i]->uring_register(iov, n, owner);
+
+			if (owner == NULL) {
+				break;
+			}
+		}
+	}
+}
+
+/** Create the io_uring instances, one for each segment
+@return DB_SUCCESS or DB_ERROR */
+dberr_t
+AIO::init_io_uring()
+{
+	ut_a(m_uring == NULL);
+
+	m_uring = static_cast<IOUring*>(
+		ut_zalloc_nokey(m_n_segments * sizeof *m_uring));
+
+	if (m_uring == NULL) {
+		return(DB_OUT_OF_MEMORY);
+	}
+
+	for (ulint i = 0; i < m_n_segments; ++i) {
+		if (int err = m_uring[i].create(
+			    unsigned(slots_per_segment()))) {
+			ib::warn() << "io_uring_setup() failed with error "
+				<< -err;
+
+			while (i--) {
+				m_uring[i].destroy();
+			}
+
+			ut_free(m_uring);
+			m_uring = NULL;
+			return(DB_ERROR);
+		}
+	}
+
+	return(DB_SUCCESS);
+}
+
+/** Checks if the kernel supports everything that we need from io_uring.
+@return true if supported, false otherwise. */
+bool
+AIO::is_io_uring_supported()
+{
+	IOUring	ring;
+
+	if (int err = ring.create(1)) {
+		ib::warn() << "io_uring is not available: error " << -err;
+		return(false);
+	}
+
+	ring.destroy();
+	return(true);
+}
+#endif /* HAVE_IO_URING */
+
 /** Creates an io_context for native linux AIO.
 @param[in]	max_events	number of events
 @param[out]	io_ctx		io_ctx to initialize.
@@ -5556,6 +6300,9 @@ AIO::AIO(
 	,m_aio_ctx(),
 	m_events(m_slots.size())
 # endif /* LINUX_NATIVE_AIO */
+# ifdef HAVE_IO_URING
+	,m_uring()
+# endif /* HAVE_IO_URING */
 {
 	ut_a(n > 0);
 	ut_a(m_n_segments > 0);
@@ -5660,6 +6407,11 @@ AIO::init()
 
 
 	if (srv_use_native_aio) {
+#ifdef HAVE_IO_URING
+		if (os_aio_use_io_uring && init_io_uring() == DB_SUCCESS) {
+			return(init_slots());
+		}
+#endif /* HAVE_IO_URING */
 #ifdef LINUX_NATIVE_AIO
 		dberr_t	err = init_linux_native_aio();
 
@@ -5722,6 +6474,15 @@ AIO::~AIO()
 		ut_free(m_aio_ctx);
 	}
 #endif /* LINUX_NATIVE_AIO */
+#ifdef HAVE_IO_URING
+	if (m_uring) {
+		for (ulint i = 0; i < m_n_segments; ++i) {
+			m_uring[i].destroy();
+		}
+
+		ut_free(m_uring);
+	}
+#endif /* HAVE_IO_URING */
 #if defined(WIN_ASYNC_IO)
 	CloseHandle(m_completion_port);
 #endif
@@ -5748,9 +6509,24 @@ AIO::start(
 	ulint		n_writers,
 	ulint		n_slots_sync)
 {
+#ifdef HAVE_IO_URING
+	os_aio_use_io_uring = srv_use_native_aio && srv_use_io_uring
+		&& is_io_uring_supported();
+
+	if (os_aio_use_io_uring) {
+		ib::info() << "Using io_uring";
+	} else if (srv_use_native_aio && srv_use_io_uring) {
+		ib::warn() << "io_uring disabled; using libaio instead.";
+	}
+#endif /* HAVE_IO_URING */
+
 #if defined(LINUX_NATIVE_AIO)
 	/* Check if native aio is supported on this system and tmpfs */
-	if (srv_use_native_aio && !is_linux_native_aio_supported()) {
+	if (srv_use_native_aio
+# ifdef HAVE_IO_URING
+	    && !os_aio_use_io_uring
+# endif /* HAVE_IO_URING */
+	    && !is_linux_native_aio_supported()) {
 
 		ib::warn() << "Linux Native AIO disabled.";
 
@@ -5900,6 +6676,51 @@ os_aio_init(
 	return(AIO::start(limit, n_readers, n_writers, n_slots_sync));
 }
 
+#ifdef HAVE_IO_URING
+/** Register memory regions, such as the buffer pool chunks, for
+fixed-buffer reads and writes with io_uring. Any earlier registration
+is replaced.
+@param[in]	iov	memory regions
+@param[in]	n	number of regions; 0 unregisters */
+void
+os_aio_register_buffers(const iovec* iov, ulint n)
+{
+	if (!os_aio_use_io_uring) {
+		return;
+	}
+
+	/* The kernel limits a registered buffer to 1GiB. */
+	const size_t		max_len = 1 << 30;
+	std::vector<iovec>	bufs;
+
+	for (ulint i = 0; i < n; i++) {
+		byte*	ptr = static_cast<byte*>(iov[i].iov_base);
+
+		for (size_t len = iov[i].iov_len; len; ) {
+			iovec	buf;
+
+			buf.iov_base = ptr;
+			buf.iov_len = std::min(len, max_len);
+			bufs.push_back(buf);
+
+			ptr += buf.iov_len;
+			len -= buf.iov_len;
+		}
+	}
+
+	std::sort(bufs.begin(), bufs.end(), os_aio_iov_cmp);
+
+	/* buf_index of a submission queue entry is 16 bits, and
+	the kernel accepts at most IOV_MAX buffers. The remaining
+	regions are read and written without registration. */
+	if (bufs.size() > IOV_MAX) {
+		bufs.resize(IOV_MAX);
+	}
+
+	AIO::uring_register_all(bufs.empty() ? NULL : &bufs[0], bufs.size());
+}
+#endif /* HAVE_IO_URING */
+
 /** Frees the asynchronous io system. */
 void
 os_aio_free()
@@ -6216,6 +7037,14 @@ void
 os_aio_simulated_wake_handler_threads()
 {
 	if (srv_use_native_aio) {
+#ifdef HAVE_IO_URING
+		/* Submit the batch that was queued with
+		IORequest::DO_NOT_WAKE, such as read-ahead or the pages
+		of a flush batch, with one system call per segment. */
+		if (os_aio_use_io_uring) {
+			AIO::uring_submit_all();
+		}
+#endif /* HAVE_IO_URING */
 		/* We do not use simulated aio: do nothing */
 
 		return;
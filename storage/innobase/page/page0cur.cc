@@ -295,6 +295,122 @@ page_cur_rec_field_extends(
 }
 #endif /* PAGE_CUR_LE_OR_EXTENDS */
 
+/** Read a fixed-length binary key of at most 8 bytes as a big-endian
+unsigned integer. Such keys compare like these integers.
+@param[in]	b	key
+@param[in]	len	length of the key, between 1 and 8 bytes
+@return the key as an integer */
+static inline
+ib_uint64_t
+page_cur_key_prefix(const byte* b, ulint len)
+{
+	switch (len) {
+	case 8:
+		return(mach_read_from_8(b));
+	case 4:
+		return(mach_read_from_4(b));
+	}
+
+	ib_uint64_t	key = 0;
+
+	do {
+		key = key << 8 | *b++;
+	} while (--len);
+
+	return(key);
+}
+
+/** Determine whether the first field of a search can be compared with
+page_cur_key_prefix(). This holds for NOT NULL INT, BIGINT and similar
+columns, for BINARY(n) columns with n<=8 and for DB_ROW_ID, as long as
+the field is stored at the start of every record.
+@param[in]	index	B-tree index
+@param[in]	tuple	search tuple
+@return length of the first field
+@retval 0 if the fast path cannot be used */
+ulint
+page_cur_key_prefix_len(const dict_index_t* index, const dtuple_t* tuple)
+{
+	if (!dict_table_is_comp(index->table)
+	    || dict_index_is_ibuf(index)
+	    || dict_index_is_spatial(index)
+	    || !dtuple_get_n_fields_cmp(tuple)
+	    || (dtuple_get_info_bits(tuple) & REC_INFO_MIN_REC_FLAG)) {
+		return(0);
+	}
+
+	const dict_field_t*	field = dict_index_get_nth_field(index, 0);
+	const dict_col_t*	col = field->col;
+
+	if (!field->fixed_len || field->fixed_len > 8
+	    || !(col->prtype & DATA_NOT_NULL)) {
+		return(0);
+	}
+
+	switch (col->mtype) {
+	case DATA_FIXBINARY:
+		if (dtype_get_charset_coll(col->prtype)
+		    != DATA_MYSQL_BINARY_CHARSET_COLL) {
+			return(0);
+		}
+		/* fall through */
+	case DATA_INT:
+	case DATA_SYS:
+		break;
+	default:
+		return(0);
+	}
+
+	if (dfield_get_len(dtuple_get_nth_field(tuple, 0))
+	    != field->fixed_len) {
+		return(0);
+	}
+
+	return(field->fixed_len);
+}
+
+/** Compare a search tuple with a record on the first field only,
+without rec_get_offsets().
+@param[in]	tuple		search tuple
+@param[in]	key		page_cur_key_prefix() of the first field
+				of tuple
+@param[in]	len		page_cur_key_prefix_len()
+@param[in]	rec		user record in a ROW_FORMAT!=REDUNDANT page
+@param[out]	cmp		the comparison result
+@param[out]	matched_fields	number of completely matched fields
+@return whether the comparison was resolved */
+static inline
+bool
+page_cur_cmp_key_prefix(
+	const dtuple_t*	tuple,
+	ib_uint64_t	key,
+	ulint		len,
+	const rec_t*	rec,
+	int*		cmp,
+	ulint*		matched_fields)
+{
+	if (UNIV_UNLIKELY(rec_get_info_bits(rec, TRUE)
+			  & REC_INFO_MIN_REC_FLAG)) {
+		return(false);
+	}
+
+	const ib_uint64_t	rec_key = page_cur_key_prefix(rec, len);
+
+	if (key != rec_key) {
+		*cmp = key < rec_key ? -1 : 1;
+		*matched_fields = 0;
+		return(true);
+	}
+
+	if (dtuple_get_n_fields_cmp(tuple) == 1) {
+		*cmp = 0;
+		*matched_fields = 1;
+		return(true);
+	}
+
+	return(false);
+}
+
 /****************************************************************//**
 Searches the right position for a page cursor. */
 void
@@ -404,6 +520,16 @@ page_cur_search_with_match(
 	up_matched_fields  = *iup_matched_fields;
 	low_matched_fields = *ilow_matched_fields;
 
+	/* As long as the first field has not been matched, compare it
+	as an integer straight from the records if possible. */
+	const ulint	key_len = page_cur_key_prefix_len(index, tuple);
+	const ib_uint64_t key = key_len
+		? page_cur_key_prefix(static_cast<const byte*>(
+				dfield_get_data(dtuple_get_nth_field(
+							tuple, 0))),
+				      key_len)
+		: 0;
+
 	/* Perform binary search. First the search is done through the page
 	directory, after that as a linear search in the list of records
 	owned by the upper limit directory slot. */
@@ -422,13 +548,17 @@ page_cur_search_with_match(
 		cur_matched_fields = std::min(low_matched_fields,
 					      up_matched_fields);
 
-		offsets = offsets_;
-		offsets = rec_get_offsets(
-			mid_rec, index, offsets, is_leaf,
-			dtuple_get_n_fields_cmp(tuple), &heap);
+		if (!key_len || cur_matched_fields
+		    || !page_cur_cmp_key_prefix(tuple, key, key_len, mid_rec,
+						&cmp, &cur_matched_fields)) {
+			offsets = offsets_;
+			offsets = rec_get_offsets(
+				mid_rec, index, offsets, is_leaf,
+				dtuple_get_n_fields_cmp(tuple), &heap);
 
-		cmp = cmp_dtuple_rec_with_match(
-			tuple, mid_rec, offsets, &cur_matched_fields);
+			cmp = cmp_dtuple_rec_with_match(
+				tuple, mid_rec, offsets, &cur_matched_fields);
+		}
 
 		if (cmp > 0) {
 low_slot_match:
@@ -476,13 +606,17 @@ page_cur_search_with_match(
 		cur_matched_fields = std::min(low_matched_fields,
 					      up_matched_fields);
 
-		offsets = offsets_;
-		offsets = rec_get_offsets(
-			mid_rec, index, offsets, is_leaf,
-			dtuple_get_n_fields_cmp(tuple), &heap);
+		if (!key_len || cur_matched_fields
+		    || !page_cur_cmp_key_prefix(tuple, key, key_len, mid_rec,
+						&cmp, &cur_matched_fields)) {
+			offsets = offsets_;
+			offsets = rec_get_offsets(
+				mid_rec, index, offsets, is_leaf,
+				dtuple_get_n_fields_cmp(tuple), &heap);
 
-		cmp = cmp_dtuple_rec_with_match(
-			tuple, mid_rec, offsets, &cur_matched_fields);
+			cmp = cmp_dtuple_rec_with_match(
+				tuple, mid_rec, offsets, &cur_matched_fields);
+		}
 
 		if (cmp > 0) {
 low_rec_match:
@@ -654,6 +654,15 @@ rec_init_offsets(
 			return;
 		case REC_STATUS_ORDINARY:
 			ut_ad(leaf);
+			if (index->fixed_offsets && !index->is_instant()) {
+				/* All fields are NOT NULL and fixed-length;
+				nothing needs to be read from the record. */
+				memcpy(rec_offs_base(offsets),
+				       index->fixed_offsets,
+				       (1 + rec_offs_n_fields(offsets))
+				       * sizeof *offsets);
+				return;
+			}
 			rec_init_offsets_comp_ordinary(rec, index, offsets,
 						       index->n_core_fields,
 						       NULL,
@@ -2580,7 +2580,9 @@ row_ins_clust_index_entry_low(
 	ulint		n_uniq,	/*!< in: 0 or index->n_uniq */
 	dtuple_t*	entry,	/*!< in/out: index entry to insert */
 	ulint		n_ext,	/*!< in: number of externally stored columns */
-	que_thr_t*	thr)	/*!< in: query thread */
+	que_thr_t*	thr,	/*!< in: query thread */
+	btr_leaf_guess_t* guess)/*!< in/out: leaf page to try before
+				descending from the root, or NULL */
 {
 	btr_pcur_t	pcur;
 	btr_cur_t*	cursor;
@@ -2646,6 +2648,26 @@ row_ins_clust_index_entry_low(
 		}
 	}
 
+	if (guess && mode == BTR_MODIFY_LEAF && !entry->is_metadata()) {
+		if (auto_inc) {
+			/* The root page must be latched before the leaf. */
+			btr_write_autoinc(index, auto_inc);
+			auto_inc = 0;
+		}
+
+		if (btr_cur_search_leaf_guess(index, entry, *guess,
+					      btr_pcur_get_btr_cur(&pcur),
+					      &mtr)) {
+			/* The leaf page of the previous insert can take
+			the entry; there is no need to descend from the
+			root. */
+			pcur.latch_mode = BTR_MODIFY_LEAF;
+			pcur.search_mode = PAGE_CUR_LE;
+			pcur.pos_state = BTR_PCUR_IS_POSITIONED;
+			goto positioned;
+		}
+	}
+
 	/* Note that we use PAGE_CUR_LE as the search mode, because then
 	the function will return in both low_match and up_match of the
 	cursor sensible values */
@@ -2657,6 +2679,7 @@ row_ins_clust_index_entry_low(
 		goto func_exit;
 	}
 
+positioned:
 	cursor = btr_pcur_get_btr_cur(&pcur);
 	cursor->thr = thr;
 
@@ -2762,6 +2785,14 @@ row_ins_clust_index_entry_low(
 				flags, cursor, &offsets, &offsets_heap,
 				entry, &insert_rec, &big_rec,
 				n_ext, thr, &mtr);
+
+			if (guess && err == DB_SUCCESS) {
+				buf_block_t* block = btr_cur_get_block(cursor);
+				guess->block = block;
+				guess->modify_clock
+					= buf_block_get_modify_clock(block);
+				guess->withdraw_clock = buf_withdraw_clock;
+			}
 		} else {
 			if (buf_LRU_buf_pool_running_out()) {
 
@@ -3177,7 +3208,14 @@ row_ins_clust_index_entry(
 	dict_index_t*	index,	/*!< in: clustered index */
 	dtuple_t*	entry,	/*!< in/out: index entry to insert */
 	que_thr_t*	thr,	/*!< in: query thread */
-	ulint		n_ext)	/*!< in: number of externally stored columns */
+	ulint		n_ext,	/*!< in: number of externally stored columns */
+	btr_leaf_guess_t* guess,/*!< in/out: leaf page to try before
+				descending from the root, or NULL */
+	ulint		bulk_flags)
+				/*!< in: BTR_NO_UNDO_LOG_FLAG
+				| BTR_NO_LOCKING_FLAG
+				| BTR_BULK_INSERT_FLAG if the statement
+				is loading an empty table, else 0 */
 {
 	dberr_t	err;
 	ulint	n_uniq;
@@ -3229,12 +3267,14 @@ row_ins_clust_index_entry(
 		flags |= BTR_NO_UNDO_LOG_FLAG | BTR_NO_LOCKING_FLAG;
 	}
 
+	flags |= bulk_flags;
+
 	/* Try first optimistic descent to the B-tree */
 	log_free_check();
 
 	err = row_ins_clust_index_entry_low(
 		flags, BTR_MODIFY_LEAF, index, n_uniq, entry,
-		n_ext, thr);
+		n_ext, thr, guess);
 
 	entry->n_fields = orig_n_fields;
 
@@ -3350,7 +3390,11 @@ row_ins_index_entry(
 /*================*/
 	dict_index_t*	index,	/*!< in: index */
 	dtuple_t*	entry,	/*!< in/out: index entry to insert */
-	que_thr_t*	thr)	/*!< in: query thread */
+	que_thr_t*	thr,	/*!< in: query thread */
+	btr_leaf_guess_t* guess,/*!< in/out: clustered index leaf page
+				to try first, or NULL */
+	ulint		bulk_flags)/*!< in: flags for an empty-table
+				bulk insert into the clustered index */
 {
 	ut_ad(thr_get_trx(thr)->id || index->table->no_rollback());
 
@@ -3359,7 +3403,8 @@ row_ins_index_entry(
 			return(DB_LOCK_WAIT);});
 
 	if (index->is_primary()) {
-		return row_ins_clust_index_entry(index, entry, thr, 0);
+		return row_ins_clust_index_entry(index, entry, thr, 0, guess,
+						 bulk_flags);
 	} else {
 		return(row_ins_sec_index_entry(index, entry, thr, true));
 	}
@@ -3502,6 +3547,93 @@ row_ins_index_entry_set_vals(
 	return(DB_SUCCESS);
 }
 
+/** Determine whether a clustered index contains no records.
+@param[in]	index	clustered index
+@return whether the index is empty */
+static bool row_ins_index_is_empty(dict_index_t* index)
+{
+	mtr_t	mtr;
+	mtr.start();
+
+	const buf_block_t*	root = btr_root_block_get(index, RW_S_LATCH,
+							  &mtr);
+	/* A metadata record for instant ALTER TABLE would make the
+	page non-empty. */
+	const bool	empty = root && page_is_leaf(root->frame)
+		&& page_is_empty(root->frame);
+
+	mtr.commit();
+	return(empty);
+}
+
+/** Determine whether a bulk insert statement is loading an empty table.
+If it is, lock the table exclusively and write a single TRX_UNDO_EMPTY
+undo log record, so that the rows of the statement can be inserted
+without undo log or record locks. A rollback of the TRX_UNDO_EMPTY
+record will remove all records of the table.
+
+This is only done when the user has disabled unique_checks and
+foreign_key_checks, and when no row can be skipped on error, because
+an error could otherwise leave a partially inserted row behind.
+@param[in,out]	node	insert node
+@param[in,out]	thr	query thread
+@return DB_SUCCESS, DB_LOCK_WAIT or error code */
+static
+dberr_t
+row_ins_bulk_check(ins_node_t* node, que_thr_t* thr)
+{
+	dict_table_t*	table	= node->table;
+	dict_index_t*	index	= dict_table_get_first_index(table);
+	trx_t*		trx	= thr_get_trx(thr);
+
+	ut_ad(node->bulk_insert);
+	ut_ad(node->bulk == INS_BULK_UNKNOWN);
+
+	node->bulk = INS_BULK_NONE;
+
+	if (trx->duplicates || trx->check_unique_secondary
+	    || trx->check_foreigns || trx->dict_operation
+	    || table->is_temporary() || table->no_rollback()
+	    || table->skip_alter_undo
+	    || dict_table_has_fts_index(table)
+	    || dict_table_has_indexed_v_cols(table)
+	    || !row_ins_index_is_empty(index)) {
+		return(DB_SUCCESS);
+	}
+
+	for (const dict_index_t* i = index; i;
+	     i = dict_table_get_next_index(i)) {
+		if (i->is_corrupted() || dict_index_is_online_ddl(i)) {
+			return(DB_SUCCESS);
+		}
+	}
+
+	dberr_t	err = lock_table(0, table, LOCK_X, thr);
+
+	if (err != DB_SUCCESS) {
+		/* Check again after a lock wait. */
+		node->bulk = INS_BULK_UNKNOWN;
+		return(err);
+	}
+
+	/* Another transaction may have inserted rows before we got
+	the table lock. */
+	if (!row_ins_index_is_empty(index)) {
+		return(DB_SUCCESS);
+	}
+
+	roll_ptr_t	roll_ptr;
+
+	err = trx_undo_report_row_operation(thr, index, NULL, NULL, 0,
+					    NULL, NULL, &roll_ptr);
+
+	if (err == DB_SUCCESS) {
+		node->bulk = INS_BULK_EMPTY;
+	}
+
+	return(err);
+}
+
 /***********************************************************//**
 Inserts a single index entry to the table.
 @return DB_SUCCESS if operation successfully completed, else error
@@ -3528,7 +3660,26 @@ row_ins_index_entry_step(
 
 	ut_ad(dtuple_check_typed(node->entry));
 
-	err = row_ins_index_entry(node->index, node->entry, thr);
+	ulint	bulk_flags = 0;
+
+	if (node->bulk_insert && node->index->is_primary()) {
+		if (node->bulk == INS_BULK_UNKNOWN) {
+			err = row_ins_bulk_check(node, thr);
+
+			if (err != DB_SUCCESS) {
+				DBUG_RETURN(err);
+			}
+		}
+
+		if (node->bulk == INS_BULK_EMPTY) {
+			bulk_flags = BTR_NO_UNDO_LOG_FLAG
+				| BTR_NO_LOCKING_FLAG | BTR_BULK_INSERT_FLAG;
+		}
+	}
+
+	err = row_ins_index_entry(node->index, node->entry, thr,
+				  node->bulk_insert
+				  ? &node->leaf_guess : NULL, bulk_flags);
 
 	DEBUG_SYNC_C_IF_THD(thr_get_trx(thr)->mysql_thd,
 			    "after_row_ins_index_entry_step");
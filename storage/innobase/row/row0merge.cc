@@ -3352,8 +3352,9 @@ row_merge_sort(
 	sol10-64 in buildbot.
 	*/
 #ifndef UNIV_SOLARIS
-	/* Progress report only for "normal" indexes. */
-	if (!(dup->index->type & DICT_FTS)) {
+	/* Progress is only reported for "normal" indexes, by the thread
+	that is executing the ALTER TABLE. */
+	if (update_progress) {
 		thd_progress_init(trx->mysql_thd, 1);
 	}
 #endif /* UNIV_SOLARIS */
@@ -3368,9 +3369,8 @@ row_merge_sort(
 	do {
 		/* Report progress of merge sort to MySQL for
 		show processlist progress field */
-		/* Progress report only for "normal" indexes. */
 #ifndef UNIV_SOLARIS
-		if (!(dup->index->type & DICT_FTS)) {
+		if (update_progress) {
 			thd_progress_report(trx->mysql_thd, file->offset - num_runs, file->offset);
 		}
 #endif /* UNIV_SOLARIS */
@@ -3397,9 +3397,8 @@ row_merge_sort(
 
 	ut_free(run_offset);
 
-	/* Progress report only for "normal" indexes. */
 #ifndef UNIV_SOLARIS
-	if (!(dup->index->type & DICT_FTS)) {
+	if (update_progress) {
 		thd_progress_end(trx->mysql_thd);
 	}
 #endif /* UNIV_SOLARIS */
@@ -4527,6 +4526,273 @@ void row_merge_write_redo(const dict_index_t* index)
 	mtr.commit();
 }
 
+/** A secondary index that is sorted and loaded by a thread of
+row_merge_build_parallel() */
+struct row_merge_build_job_t {
+	/** index to be built */
+	dict_index_t*	index;
+	/** file containing the index entries */
+	merge_file_t*	file;
+	/** outcome of sorting and loading the index */
+	dberr_t		error;
+};
+
+/** State shared by the threads of row_merge_build_parallel() */
+struct row_merge_build_t {
+	/** transaction */
+	trx_t*			trx;
+	/** table where rows are read from */
+	const dict_table_t*	old_table;
+	/** tablespace of the indexes */
+	ulint			space_id;
+	/** location of the temporary files, or NULL */
+	const char*		path;
+	/** indexes to be built */
+	row_merge_build_job_t*	jobs;
+	/** number of jobs */
+	ulint			n_jobs;
+	/** next job to be picked up by a thread */
+	Atomic_counter<ulint>	next;
+	/** number of threads that have finished */
+	Atomic_counter<ulint>	n_done;
+	/** signalled whenever a thread finishes */
+	os_event_t		done_event;
+	/** number of index entries that have been sorted */
+	Atomic_counter<ulint>	n_sorted;
+	/** number of index entries that have been inserted */
+	Atomic_counter<ulint>	n_inserted;
+	/** n_sorted already reported to stage */
+	ulint			n_sorted_reported;
+	/** n_inserted already reported to stage */
+	ulint			n_inserted_reported;
+};
+
+/** Report the progress of a parallel index build. ut_stage_alter_t is
+not thread-safe, so only the thread that runs the ALTER TABLE reports
+the work that all threads have completed so far.
+@param[in,out]	build	parallel index build
+@param[in,out]	stage	performance schema accounting object, or NULL */
+static
+void
+row_merge_build_progress(
+	row_merge_build_t*	build,
+	ut_stage_alter_t*	stage)
+{
+	if (stage == NULL) {
+		return;
+	}
+
+	const ulint	n_sorted = build->n_sorted;
+
+	if (build->n_sorted_reported < n_sorted) {
+		/* Every entry is reported once, not once per merge pass. */
+		stage->begin_phase_sort(1.0);
+
+		do {
+			stage->inc();
+		} while (++build->n_sorted_reported < n_sorted);
+	}
+
+	const ulint	n_inserted = build->n_inserted;
+
+	if (build->n_inserted_reported < n_inserted) {
+		stage->begin_phase_insert();
+
+		do {
+			stage->inc();
+		} while (++build->n_inserted_reported < n_inserted);
+	}
+}
+
+/** Sort and load secondary indexes until none are left.
+@param[in,out]	build		parallel index build
+@param[in,out]	block		3 buffers of srv_sort_buf_size
+@param[in,out]	crypt_block	3 buffers for encryption, or NULL
+@param[in,out]	tmpfd		temporary file handle
+@param[in,out]	stage		performance schema accounting object
+of the ALTER TABLE thread, or NULL in the other threads */
+static
+void
+row_merge_build_run(
+	row_merge_build_t*	build,
+	row_merge_block_t*	block,
+	row_merge_block_t*	crypt_block,
+	pfs_os_file_t*		tmpfd,
+	ut_stage_alter_t*	stage)
+{
+	for (ulint i; (i = build->next++) < build->n_jobs; ) {
+		row_merge_build_job_t*	job = &build->jobs[i];
+		/* Only non-unique indexes are built in parallel, so that
+		no duplicates can be reported to the MySQL table object. */
+		row_merge_dup_t		dup = {job->index, NULL, NULL, 0};
+
+		ut_ad(!dict_index_is_unique(job->index));
+
+		if (!row_merge_tmpfile_if_needed(tmpfd, build->path)) {
+			job->error = DB_OUT_OF_MEMORY;
+			continue;
+		}
+
+		/* The threads count the completed work, and
+		row_merge_build_progress() reports it. */
+		job->error = row_merge_sort(
+			build->trx, &dup, job->file, block, tmpfd, false,
+			0, 0, crypt_block, build->space_id);
+
+		if (job->error == DB_SUCCESS) {
+			build->n_sorted += job->file->n_rec;
+			row_merge_build_progress(build, stage);
+
+			BtrBulk	btr_bulk(job->index, build->trx,
+					 build->trx->get_flush_observer());
+
+			job->error = row_merge_insert_index_tuples(
+				job->index, build->old_table, job->file->fd,
+				block, NULL, &btr_bulk, job->file->n_rec,
+				0, 0, crypt_block, build->space_id);
+
+			job->error = btr_bulk.finish(job->error);
+
+			if (job->error == DB_SUCCESS) {
+				build->n_inserted += job->file->n_rec;
+			}
+		}
+
+		row_merge_build_progress(build, stage);
+	}
+}
+
+/** Thread of a parallel index build.
+@param[in,out]	arg	row_merge_build_t
+@return OS_THREAD_DUMMY_RETURN */
+static
+os_thread_ret_t
+DECLARE_THREAD(row_merge_build_thread)(void* arg)
+{
+	row_merge_build_t*	build = static_cast<row_merge_build_t*>(arg);
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	const size_t		block_size = 3 * srv_sort_buf_size;
+	ut_new_pfx_t		block_pfx;
+	ut_new_pfx_t		crypt_pfx;
+	row_merge_block_t*	block;
+	row_merge_block_t*	crypt_block = NULL;
+	pfs_os_file_t		tmpfd = OS_FILE_CLOSED;
+
+	block = alloc.allocate_large(block_size, &block_pfx);
+
+	if (block != NULL && log_tmp_is_encrypted()) {
+		crypt_block = alloc.allocate_large(block_size, &crypt_pfx);
+
+		if (crypt_block == NULL) {
+			alloc.deallocate_large(block, &block_pfx, block_size);
+			block = NULL;
+		}
+	}
+
+	/* If memory is short, leave the work to the other threads. */
+	if (block != NULL) {
+		row_merge_build_run(build, block, crypt_block, &tmpfd, NULL);
+
+		row_merge_file_destroy_low(tmpfd);
+		alloc.deallocate_large(block, &block_pfx, block_size);
+
+		if (crypt_block != NULL) {
+			alloc.deallocate_large(crypt_block, &crypt_pfx,
+					       block_size);
+		}
+	}
+
+	build->n_done++;
+	os_event_set(build->done_event);
+
+	os_thread_exit(false);
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
+/** Look up an index in a parallel index build.
+@param[in]	build	parallel index build
+@param[in]	index	index
+@return the job that built the index, or NULL */
+static
+const row_merge_build_job_t*
+row_merge_build_find(
+	const row_merge_build_t&	build,
+	const dict_index_t*		index)
+{
+	for (ulint i = 0; i < build.n_jobs; i++) {
+		if (build.jobs[i].index == index) {
+			return(&build.jobs[i]);
+		}
+	}
+
+	return(NULL);
+}
+
+/** Sort and load secondary indexes concurrently. The calling thread
+takes part in the work with its own buffers and temporary file.
+@param[in,out]	build		parallel index build
+@param[in]	n_threads	number of threads, including the caller
+@param[in,out]	block		3 buffers of srv_sort_buf_size
+@param[in,out]	crypt_block	3 buffers for encryption, or NULL
+@param[in,out]	tmpfd		temporary file handle
+@param[in,out]	stage		performance schema accounting object, used by
+ALTER TABLE. stage->begin_phase_sort() and stage->begin_phase_insert() will
+be called, and stage->inc() once for each index entry sorted or inserted by
+any of the threads. */
+static
+void
+row_merge_build_parallel(
+	row_merge_build_t*	build,
+	ulint			n_threads,
+	row_merge_block_t*	block,
+	row_merge_block_t*	crypt_block,
+	pfs_os_file_t*		tmpfd,
+	ut_stage_alter_t*	stage)
+{
+	ut_ad(n_threads > 1);
+	ut_ad(n_threads <= build->n_jobs);
+
+	build->next = 0;
+	build->n_done = 0;
+	build->n_sorted = 0;
+	build->n_inserted = 0;
+	build->n_sorted_reported = 0;
+	build->n_inserted_reported = 0;
+	build->done_event = os_event_create(0);
+
+	os_thread_t*	handles = static_cast<os_thread_t*>(
+		ut_malloc_nokey(n_threads * sizeof *handles));
+
+	for (ulint i = 1; i < n_threads; i++) {
+		handles[i] = os_thread_create(
+			row_merge_build_thread, build, NULL);
+	}
+
+	row_merge_build_run(build, block, crypt_block, tmpfd, stage);
+
+	for (;;) {
+		int64_t	sig_count = os_event_reset(build->done_event);
+
+		if (build->n_done == n_threads - 1) {
+			break;
+		}
+
+		/* Keep reporting the progress of the other threads. */
+		os_event_wait_time_low(build->done_event, 100000, sig_count);
+		row_merge_build_progress(build, stage);
+	}
+
+	row_merge_build_progress(build, stage);
+
+	for (ulint i = 1; i < n_threads; i++) {
+		os_thread_join(handles[i]);
+	}
+
+	ut_free(handles);
+	os_event_destroy(build->done_event);
+}
+
 /** Build indexes on a table by reading a clustered index, creating a temporary
 file containing index entries, merge sorting these index entries and inserting
 sorted index entries to indexes.
@@ -4591,6 +4857,7 @@ row_merge_build_indexes(
 	fts_psort_t*		merge_info = NULL;
 	int64_t			sig_count = 0;
 	bool			fts_psort_initiated = false;
+	row_merge_build_t	build;
 
 	double total_static_cost = 0;
 	double total_dynamic_cost = 0;
@@ -4604,6 +4871,9 @@ row_merge_build_indexes(
 	ut_ad((old_table == new_table) == !col_map);
 	ut_ad(!defaults || col_map);
 
+	build.jobs = NULL;
+	build.n_jobs = 0;
+
 	stage->begin_phase_read_pk(skip_pk_sort && new_table != old_table
 				   ? n_indexes - 1
 				   : n_indexes);
@@ -4745,6 +5015,60 @@ row_merge_build_indexes(
 
 	DEBUG_SYNC_C("row_merge_after_scan");
 
+	/* Non-unique secondary indexes cannot report duplicates to the
+	MySQL table object, so they can be sorted and loaded concurrently.
+	Everything else, including applying the online log, is done below
+	one index at a time. */
+	build.jobs = static_cast<row_merge_build_job_t*>(
+		ut_malloc_nokey(n_indexes * sizeof *build.jobs));
+
+	for (ulint k = 0, i = 0; i < n_indexes; i++) {
+		if (dict_index_is_spatial(indexes[i])) {
+			continue;
+		}
+
+		if (!(indexes[i]->type & DICT_FTS)
+		    && !dict_index_is_unique(indexes[i])
+		    && merge_files[k].fd != OS_FILE_CLOSED) {
+			row_merge_build_job_t&	job
+				= build.jobs[build.n_jobs++];
+			job.index = indexes[i];
+			job.file = &merge_files[k];
+			job.error = DB_SUCCESS;
+		}
+
+		k++;
+	}
+
+	if (ulint n_threads = std::min<ulint>(
+		    thd_ddl_threads(trx->mysql_thd), build.n_jobs)) {
+		if (n_threads > 1) {
+			build.trx = trx;
+			build.old_table = old_table;
+			build.space_id = new_table->space_id;
+			build.path = thd_innodb_tmpdir(trx->mysql_thd);
+
+			if (global_system_variables.log_warnings > 2) {
+				sql_print_information(
+					"InnoDB: Online DDL : Start sorting and"
+					" building " ULINTPF " indexes in "
+					ULINTPF " threads",
+					build.n_jobs, n_threads);
+			}
+
+			row_merge_build_parallel(&build, n_threads, block,
+						 crypt_block, &tmpfd, stage);
+
+			if (global_system_variables.log_warnings > 2) {
+				sql_print_information(
+					"InnoDB: Online DDL : End of sorting"
+					" and building indexes in parallel");
+			}
+		} else {
+			build.n_jobs = 0;
+		}
+	}
+
 	/* Now we have files containing index entries ready for
 	sorting and inserting. */
 
@@ -4827,6 +5151,16 @@ row_merge_build_indexes(
 #ifdef FTS_INTERNAL_DIAG_PRINT
 			DEBUG_FTS_SORT_PRINT("FTS_SORT: Complete Insert\n");
 #endif
+		} else if (const row_merge_build_job_t* job
+			   = row_merge_build_find(build, sort_idx)) {
+			pct_progress += (COST_BUILD_INDEX_STATIC +
+				(total_dynamic_cost * job->file->offset /
+					total_index_blocks)) /
+				(total_static_cost + total_dynamic_cost)
+				* (PCT_COST_MERGESORT_INDEX
+				   + PCT_COST_INSERT_INDEX) * 100;
+			onlineddl_pct_progress = (ulint) (pct_progress * 100);
+			error = job->error;
 		} else if (merge_files[k].fd != OS_FILE_CLOSED) {
 			char	buf[NAME_LEN + 1];
 			row_merge_dup_t	dup = {
@@ -4994,6 +5328,7 @@ row_merge_build_indexes(
 	}
 
 	ut_free(merge_files);
+	ut_free(build.jobs);
 
 	alloc.deallocate_large(block, &block_pfx, block_size);
 
@@ -1414,6 +1414,7 @@ row_insert_for_mysql(
 
 	row_get_prebuilt_insert_row(prebuilt);
 	node = prebuilt->ins_node;
+	node->bulk_insert = prebuilt->bulk_insert;
 
 	row_mysql_convert_row_to_innobase(node->row, prebuilt, mysql_rec,
 					  &blob_heap);
@@ -1484,6 +1485,11 @@ row_insert_for_mysql(
 			goto run_again;
 		}
 
+		/* The rollback to savept may have removed the
+		TRX_UNDO_EMPTY record. Any further rows must be
+		inserted normally. */
+		node->bulk = INS_BULK_NONE;
+
 		trx->op_info = "";
 
 		if (blob_heap != NULL) {
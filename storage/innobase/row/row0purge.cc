@@ -1036,6 +1036,7 @@ row_purge_parse_undo_rec(
 	node->rec_type = type;
 
 	switch (type) {
+	case TRX_UNDO_EMPTY:
 	case TRX_UNDO_RENAME_TABLE:
 		return false;
 	case TRX_UNDO_INSERT_METADATA:
@@ -1331,7 +1332,11 @@ row_purge_step(
 	rw_lock_x_unlock(&slot->debug_sync_lock);
 #endif
 
-	if (!(node->undo_recs == NULL || ib_vector_is_empty(node->undo_recs))) {
+	if (node->undo_recs == NULL || ib_vector_is_empty(node->undo_recs)) {
+		node->undo_recs = purge_sys.claim_chunk();
+	}
+
+	if (node->undo_recs != NULL) {
 		trx_purge_rec_t*purge_rec;
 
 		purge_rec = static_cast<trx_purge_rec_t*>(
@@ -1341,7 +1346,8 @@ row_purge_step(
 
 		row_purge(node, purge_rec->undo_rec, thr);
 
-		if (ib_vector_is_empty(node->undo_recs)) {
+		if (ib_vector_is_empty(node->undo_recs)
+		    && !(node->undo_recs = purge_sys.claim_chunk())) {
 			row_purge_end(thr);
 		} else {
 			thr->run_node = node;
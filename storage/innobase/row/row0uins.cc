@@ -412,6 +412,7 @@ static bool row_undo_ins_parse_undo_rec(undo_node_t* node, bool dict_locked)
 		goto close_table;
 	case TRX_UNDO_INSERT_METADATA:
 	case TRX_UNDO_INSERT_REC:
+	case TRX_UNDO_EMPTY:
 		break;
 	case TRX_UNDO_RENAME_TABLE:
 		dict_table_t* table = node->table;
@@ -445,6 +446,13 @@ static bool row_undo_ins_parse_undo_rec(undo_node_t* node, bool dict_locked)
 		return false;
 	} else {
 		ut_ad(!node->table->skip_alter_undo);
+
+		if (node->rec_type == TRX_UNDO_EMPTY) {
+			/* The record carries no row reference; see
+			row_undo_ins_remove_all(). */
+			return true;
+		}
+
 		clust_index = dict_table_get_first_index(node->table);
 
 		if (clust_index != NULL) {
@@ -538,6 +546,127 @@ row_undo_ins_remove_sec_rec(
 	return(err);
 }
 
+/** Roll back TRX_UNDO_EMPTY: remove all records of a table that was
+empty before a bulk insert, which inserted the records without undo log.
+The table is locked exclusively by the transaction, and any later
+changes to the records have already been rolled back. Records of other
+transactions are left alone.
+@param[in,out]	node	row rollback state
+@param[in,out]	thr	query thread
+@return DB_SUCCESS or DB_OUT_OF_FILE_SPACE */
+static MY_ATTRIBUTE((nonnull, warn_unused_result))
+dberr_t
+row_undo_ins_remove_all(undo_node_t* node, que_thr_t* thr)
+{
+	dict_index_t*	clust_index = dict_table_get_first_index(node->table);
+	byte*		heap_top = mem_heap_get_heap_top(node->heap);
+	mem_heap_t*	heap = mem_heap_create(256);
+	ulint		offsets_[REC_OFFS_NORMAL_SIZE];
+	ulint*		offsets;
+	/* the key of the previous record, or NULL to start from the
+	first record of the table */
+	const dtuple_t*	prev = NULL;
+	dberr_t		err = DB_SUCCESS;
+
+	ut_ad(!node->table->is_temporary());
+	rec_offs_init(offsets_);
+
+	/* The DB_ROLL_PTR that btr_cur_ins_lock_and_undo() wrote for
+	BTR_NO_UNDO_LOG_FLAG */
+	node->roll_ptr = roll_ptr_t(1) << ROLL_PTR_INSERT_FLAG_POS;
+
+	for (;;) {
+		mtr_t	mtr;
+		mtr.start();
+
+		if (prev) {
+			/* The previous record was removed, or it
+			belongs to another transaction. */
+			btr_pcur_open(clust_index, prev, PAGE_CUR_G,
+				      BTR_SEARCH_LEAF, &node->pcur, &mtr);
+		} else {
+			err = btr_pcur_open_at_index_side(
+				true, clust_index, BTR_SEARCH_LEAF,
+				&node->pcur, true, 0, &mtr);
+		}
+
+		const bool found = err == DB_SUCCESS
+			&& (btr_pcur_is_on_user_rec(&node->pcur)
+			    || btr_pcur_move_to_next_user_rec(&node->pcur,
+							      &mtr));
+		bool	own = false;
+
+		if (found) {
+			const rec_t*	rec = btr_pcur_get_rec(&node->pcur);
+
+			mem_heap_empty(heap);
+			offsets = rec_get_offsets(rec, clust_index, offsets_,
+						  true, ULINT_UNDEFINED,
+						  &heap);
+			own = row_get_rec_trx_id(rec, clust_index, offsets)
+				== node->trx->id;
+			prev = dict_index_build_data_tuple(
+				rec, clust_index, true,
+				dict_index_get_n_unique(clust_index), heap);
+		}
+
+		mtr.commit();
+		btr_pcur_close(&node->pcur);
+
+		if (!found) {
+			break;
+		}
+
+		if (!own) {
+			/* Purge may have reset DB_TRX_ID and DB_ROLL_PTR
+			of a committed record to the values that the
+			bulk insert writes. Such a record must not be
+			matched by row_undo_search_clust_to_pcur(). */
+			continue;
+		}
+
+		node->ref = prev;
+
+		if (!row_undo_search_clust_to_pcur(node)) {
+			ut_ad(!"record was modified after the bulk insert");
+			err = DB_CORRUPTION;
+			break;
+		}
+
+		node->index = dict_table_get_next_index(clust_index);
+		dict_table_skip_corrupt_index(node->index);
+
+		err = row_undo_ins_remove_sec_rec(node, thr);
+
+		if (err == DB_SUCCESS) {
+			log_free_check();
+			err = row_undo_ins_remove_clust_rec(node);
+		}
+
+		btr_pcur_close(&node->pcur);
+
+		if (err != DB_SUCCESS) {
+			break;
+		}
+
+		if (node->table->stat_initialized) {
+			dict_table_n_rows_dec(node->table);
+		}
+
+		mem_heap_free_heap_top(node->heap, heap_top);
+	}
+
+	node->ref = NULL;
+	mem_heap_free(heap);
+
+	if (node->table->stat_initialized
+	    && node->trx->dict_operation_lock_mode != RW_X_LATCH) {
+		dict_stats_update_if_needed(node->table, node->trx->mysql_thd);
+	}
+
+	return(err);
+}
+
 /***********************************************************//**
 Undoes a fresh insert of a row to a table. A fresh insert means that
 the same clustered index unique key did not have any record, even delete
@@ -617,6 +746,10 @@ row_undo_ins(
 		log_free_check();
 		ut_ad(!node->table->is_temporary());
 		err = row_undo_ins_remove_clust_rec(node);
+		break;
+
+	case TRX_UNDO_EMPTY:
+		err = row_undo_ins_remove_all(node, thr);
 	}
 
 	dict_table_close(node->table, dict_locked, FALSE);
@@ -377,6 +377,7 @@ static bool row_undo_rec_get(undo_node_t* node)
 		this record can only be present in the main undo log. */
 		ut_ad(undo == update);
 		/* fall through */
+	case TRX_UNDO_EMPTY:
 	case TRX_UNDO_RENAME_TABLE:
 		ut_ad(undo == insert || undo == update);
 		/* fall through */
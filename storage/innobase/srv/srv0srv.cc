@@ -155,6 +155,9 @@ OS (provided we compiled Innobase with it in), otherwise we will
 use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 my_bool	srv_use_native_aio;
+/** innodb_use_io_uring: whether to use io_uring instead of libaio
+for the native asynchronous I/O on Linux */
+my_bool	srv_use_io_uring;
 my_bool	srv_numa_interleave;
 /** copy of innodb_use_atomic_writes; @see innodb_init_params() */
 my_bool	srv_use_atomic_writes;
@@ -250,6 +253,8 @@ ulong	srv_idle_flush_pct;
 ulong	srv_n_read_io_threads;
 /** innodb_write_io_threads */
 ulong	srv_n_write_io_threads;
+/** innodb_recovery_threads */
+uint	srv_n_recovery_threads;
 
 /** innodb_random_read_ahead */
 my_bool	srv_random_read_ahead;
@@ -275,6 +280,9 @@ ulong	srv_max_io_capacity;
 
 /** innodb_page_cleaners; the number of page cleaner threads */
 ulong	srv_n_page_cleaners;
+/** innodb_page_cleaner_independent; whether each buffer pool instance
+is flushed on its own schedule instead of in common rounds */
+my_bool	srv_page_cleaner_independent;
 
 /* The InnoDB main thread tries to keep the ratio of modified pages
 in the buffer pool to all database pages in the buffer pool smaller than
@@ -369,6 +377,9 @@ number of pages to use in LRU and flush_list batch flushing.
 The rest of the doublewrite buffer is used for single-page flushing. */
 ulong	srv_doublewrite_batch_size = 120;
 
+/** innodb_doublewrite_shards */
+ulong	srv_doublewrite_shards;
+
 /** innodb_replication_delay */
 ulong	srv_replication_delay;
 
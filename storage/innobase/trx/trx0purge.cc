@@ -166,6 +166,8 @@ void purge_sys_t::create()
   ut_ad(event);
   m_paused= 0;
   query= purge_graph_build();
+  heap= mem_heap_create(srv_page_size);
+  next_chunk= 0;
   next_stored= false;
   rseg= NULL;
   page_no= 0;
@@ -192,6 +194,8 @@ void purge_sys_t::close()
   ut_ad(trx->state == TRX_STATE_ACTIVE);
   trx->state= TRX_STATE_NOT_STARTED;
   trx_free(trx);
+  chunks.clear();
+  mem_heap_free(heap);
   rw_lock_free(&latch);
   mutex_free(&pq_mutex);
   os_event_destroy(event);
@@ -1108,17 +1112,16 @@ static
 ulint
 trx_purge_attach_undo_recs(ulint n_purge_threads)
 {
-	que_thr_t*	thr;
-	ulint		i;
 	ulint		n_pages_handled = 0;
-	ulint		n_thrs = UT_LIST_GET_LEN(purge_sys.query->thrs);
 
 	ut_a(n_purge_threads > 0);
+	ut_a(UT_LIST_GET_LEN(purge_sys.query->thrs) > 0);
 
 	purge_sys.head = purge_sys.tail;
 
 #ifdef UNIV_DEBUG
-	i = 0;
+	que_thr_t*	thr;
+	ulint		i = 0;
 	/* Debug code to validate some pre-requisites and reset done flag. */
 	for (thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
 	     thr != NULL && i < n_purge_threads;
@@ -1140,29 +1143,20 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 	ut_ad(i == n_purge_threads);
 #endif
 
-	/* Fetch and parse the UNDO records. The UNDO records are added
-	to a per purge node vector. */
-	thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
-	ut_a(n_thrs > 0 && thr != NULL);
+	/* Fetch the UNDO records, tagged with the table they belong to. */
+	typedef std::pair<table_id_t, trx_purge_rec_t> purge_rec_t;
+	std::vector<purge_rec_t, ut_allocator<purge_rec_t> > recs;
 
-	ut_ad(purge_sys.head <= purge_sys.tail);
+	mem_heap_empty(purge_sys.heap);
+	purge_sys.chunks.clear();
+	purge_sys.next_chunk = 0;
 
-	i = 0;
+	ut_ad(purge_sys.head <= purge_sys.tail);
 
 	const ulint batch_size = srv_purge_batch_size;
 
 	while (UNIV_LIKELY(srv_undo_sources) || !srv_fast_shutdown) {
-		purge_node_t*		node;
-		trx_purge_rec_t*	purge_rec;
-
-		ut_a(!thr->is_active);
-
-		/* Get the purge node. */
-		node = (purge_node_t*) thr->child;
-		ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
-
-		purge_rec = static_cast<trx_purge_rec_t*>(
-			mem_heap_zalloc(node->heap, sizeof(*purge_rec)));
+		trx_purge_rec_t	purge_rec;
 
 		/* Track the max {trx_id, undo_no} for truncating the
 		UNDO logs once we have purged the records. */
@@ -1172,37 +1166,73 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 		}
 
 		/* Fetch the next record, and advance the purge_sys.tail. */
-		purge_rec->undo_rec = trx_purge_fetch_next_rec(
-			&purge_rec->roll_ptr, &n_pages_handled, node->heap);
-
-		if (purge_rec->undo_rec != NULL) {
-
-			if (node->undo_recs == NULL) {
-				node->undo_recs = ib_vector_create(
-					ib_heap_allocator_create(node->heap),
-					sizeof(trx_purge_rec_t),
-					batch_size);
-			} else {
-				ut_a(!ib_vector_is_empty(node->undo_recs));
-			}
+		purge_rec.undo_rec = trx_purge_fetch_next_rec(
+			&purge_rec.roll_ptr, &n_pages_handled, purge_sys.heap);
 
-			ib_vector_push(node->undo_recs, purge_rec);
+		if (purge_rec.undo_rec == NULL) {
+			break;
+		}
 
-			if (n_pages_handled >= batch_size) {
+		table_id_t	table_id = 0;
 
-				break;
-			}
-		} else {
-			break;
+		if (purge_rec.undo_rec != &trx_purge_dummy_rec) {
+			ulint		type;
+			ulint		cmpl_info;
+			bool		updated_extern;
+			undo_no_t	undo_no;
+
+			trx_undo_rec_get_pars(purge_rec.undo_rec, &type,
+					      &cmpl_info, &updated_extern,
+					      &undo_no, &table_id);
 		}
 
-		thr = UT_LIST_GET_NEXT(thrs, thr);
+		recs.push_back(purge_rec_t(table_id, purge_rec));
+
+		if (n_pages_handled >= batch_size) {
+			break;
+		}
+	}
 
-		if (!(++i % n_purge_threads)) {
-			thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
+	/* Group the records by table, keeping their undo log order
+	within each table. Each chunk covers a single table, so that a
+	purge thread keeps working on the same table, and it is purged in
+	undo log order. A table that has more than its share of the batch
+	is cut into several chunks, so that all purge threads can work on
+	it; those chunks may be purged concurrently. The chunks are
+	claimed by the purge threads one at a time, so that a thread that
+	is done with its chunk takes over work that is still left. */
+	std::stable_sort(recs.begin(), recs.end(),
+			 [](const purge_rec_t& a, const purge_rec_t& b)
+			 { return a.first < b.first; });
+
+	const ulint	max_chunk = std::max<ulint>(
+		1, recs.size() / (2 * n_purge_threads));
+
+	for (ulint start = 0, end; start < recs.size(); start = end) {
+		for (end = start + 1;
+		     end < recs.size() && recs[end].first == recs[start].first;
+		     end++) {
 		}
 
-		ut_a(thr != NULL);
+		const ulint	n = end - start;
+		const ulint	n_chunks = (n + max_chunk - 1) / max_chunk;
+		const ulint	chunk_size = (n + n_chunks - 1) / n_chunks;
+
+		for (ulint i = start; i < end; i += chunk_size) {
+			ib_vector_t*	chunk = ib_vector_create(
+				ib_heap_allocator_create(purge_sys.heap),
+				sizeof(trx_purge_rec_t), chunk_size);
+
+			/* row_purge_step() takes the records from the
+			end of the chunk; push them in reverse order, so
+			that they are purged in undo log order. */
+			for (ulint j = std::min(i + chunk_size, end);
+			     j-- > i; ) {
+				ib_vector_push(chunk, &recs[j].second);
+			}
+
+			purge_sys.chunks.push_back(chunk);
+		}
 	}
 
 	ut_ad(purge_sys.head <= purge_sys.tail);
@@ -567,6 +567,9 @@ trx_resurrect_table_locks(
 	page_t*			undo_page;
 	trx_undo_rec_t*		undo_rec;
 	table_id_set		tables;
+	/* tables that the transaction was loading while they
+	were empty, without undo log for the individual rows */
+	table_id_set		empty_tables;
 
 	ut_ad(trx_state_eq(trx, TRX_STATE_ACTIVE) ||
 	      trx_state_eq(trx, TRX_STATE_PREPARED));
@@ -605,6 +608,10 @@ trx_resurrect_table_locks(
 			&updated_extern, &undo_no, &table_id);
 		tables.insert(table_id);
 
+		if (type == TRX_UNDO_EMPTY) {
+			empty_tables.insert(table_id);
+		}
+
 		undo_rec = trx_undo_get_prev_rec(
 			undo_rec, undo->hdr_page_no,
 			undo->hdr_offset, false, &mtr);
@@ -629,11 +636,17 @@ trx_resurrect_table_locks(
 					trx_mod_tables_t::value_type(table,
 								     0));
 			}
-			lock_table_ix_resurrect(table, trx);
+			/* Rolling back TRX_UNDO_EMPTY removes all
+			records of the table. No other transaction may
+			insert into it until then. */
+			const bool	empty = empty_tables.count(*i) != 0;
+			lock_table_resurrect(table, trx,
+					     empty ? LOCK_X : LOCK_IX);
 
 			DBUG_LOG("ib_trx",
 				 "resurrect " << ib::hex(trx->id)
-				 << " IX lock on " << table->name);
+				 << (empty ? " X" : " IX") << " lock on "
+				 << table->name);
 
 			dict_table_close(table, FALSE, FALSE);
 		}
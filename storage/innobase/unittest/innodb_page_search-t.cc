@@ -0,0 +1,442 @@
+/*****************************************************************************
+
+Copyright (c) 2019, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file unittest/innodb_page_search-t.cc
+Test of page_cur_search_with_match() on ROW_FORMAT=COMPACT pages.
+
+Every key column type is stored twice in a table: NOT NULL, for which
+page_cur_search_with_match() compares the first field straight from the
+records, and nullable, for which it always uses rec_get_offsets() and
+cmp_dtuple_rec_with_match(). The same records are inserted into a page
+of an index on each column, and every search must position the cursor
+on the same record and report the same matched fields on both pages, and
+on the record that a linear scan of the page selects.
+*******************************************************/
+
+#include "univ.i"
+#include "tap.h"
+#include "buf0buf.h"
+#include "dict0dict.h"
+#include "dict0mem.h"
+#include "page0cur.h"
+#include "page0page.h"
+#include "rem0cmp.h"
+#include "srv0conc.h"
+#include "srv0srv.h"
+#include "sync0debug.h"
+
+/** Number of records on a test page */
+static const ulint	N_RECS = 120;
+/** Number of records with the same first field */
+static const ulint	N_DUPS = 3;
+/** Distance between successive values of the first field */
+static const int	KEY_STEP = 5;
+/** Smallest value of the first field */
+static const int	KEY_MIN = -100;
+
+/** A column type of the first index field */
+struct key_type_t {
+	/** SQL name of the type */
+	const char*	name;
+	/** main data type */
+	ulint		mtype;
+	/** precise type, without DATA_NOT_NULL */
+	ulint		prtype;
+	/** length in bytes */
+	ulint		len;
+};
+
+/** The column types for which the first field can be compared as an
+integer. The keys are stored like InnoDB stores signed integers, with
+the sign bit inverted, so that they compare like the signed values. */
+static const key_type_t	key_types[] = {
+	{ "INT", DATA_INT, DATA_BINARY_TYPE, 4 },
+	{ "BIGINT", DATA_INT, DATA_BINARY_TYPE, 8 },
+	{ "BINARY(5)", DATA_FIXBINARY,
+	  DATA_MYSQL_BINARY_CHARSET_COLL << 16 | DATA_BINARY_TYPE, 5 },
+	{ "DB_ROW_ID", DATA_SYS, DATA_ROW_ID, DATA_ROW_ID_LEN }
+};
+
+/** An index on (k,v) of a table (k,v), and a page of it */
+struct test_index_t {
+	/** the table */
+	dict_table_t*	table;
+	/** the index */
+	dict_index_t*	index;
+	/** unaligned page frame */
+	byte*		buf;
+	/** the page */
+	buf_block_t*	block;
+
+	/** Create the table, the index and an empty page.
+	@param[in]	type		type of k
+	@param[in]	not_null	whether k is NOT NULL
+	@param[in]	comp		whether ROW_FORMAT!=REDUNDANT */
+	test_index_t(const key_type_t& type, bool not_null, bool comp)
+	{
+		mem_heap_t*	heap = mem_heap_create(256);
+
+		table = dict_mem_table_create("test/t", NULL, 2, 0,
+					      comp ? DICT_TF_COMPACT : 0, 0);
+		dict_mem_table_add_col(
+			table, heap, "k", type.mtype,
+			type.prtype | (not_null ? DATA_NOT_NULL : 0),
+			type.len);
+		dict_mem_table_add_col(table, heap, "v", DATA_INT,
+				       DATA_NOT_NULL | DATA_UNSIGNED, 4);
+		mem_heap_free(heap);
+
+		index = dict_mem_index_create(table, "k", DICT_UNIQUE, 2);
+		index->id = 42;
+		dict_index_add_col(index, table, dict_table_get_nth_col(
+					   table, 0), 0);
+		dict_index_add_col(index, table, dict_table_get_nth_col(
+					   table, 1), 0);
+		index->n_uniq = 2;
+		index->n_core_null_bytes = UT_BITS_IN_BYTES(
+			unsigned(index->n_nullable));
+
+		buf = static_cast<byte*>(ut_malloc_nokey(2 * srv_page_size));
+		block = static_cast<buf_block_t*>(
+			ut_zalloc_nokey(sizeof *block));
+		block->frame = static_cast<byte*>(
+			ut_align(buf, srv_page_size));
+		block->page.state = BUF_BLOCK_MEMORY;
+		block->page.id = page_id_t(SRV_TMP_SPACE_ID, 0);
+	}
+
+	~test_index_t()
+	{
+		ut_free(block);
+		ut_free(buf);
+		dict_mem_index_free(index);
+		dict_mem_table_free(table);
+	}
+
+	/** Fill the page with N_RECS records in ascending order.
+	@param[in]	level	0 for leaf records, 1 for node pointers
+	whose first record carries REC_INFO_MIN_REC_FLAG */
+	void create_page(ulint level)
+	{
+		page_t*	page = block->frame;
+		memset(page, 0, srv_page_size);
+		page_parse_create(block, dict_table_is_comp(table), false);
+		memset(page + FIL_PAGE_PREV, 0xff, 8);
+		mach_write_to_2(page + PAGE_HEADER + PAGE_LEVEL, level);
+		mach_write_to_8(page + PAGE_HEADER + PAGE_INDEX_ID, index->id);
+
+		page_cur_t	cur;
+		page_cur_set_before_first(block, &cur);
+		mem_heap_t*	heap = NULL;
+		ulint*		offsets = NULL;
+		mem_heap_t*	tuple_heap = mem_heap_create(1024);
+		byte		b[N_RECS][8 + 4 + 4];
+
+		for (ulint i = 0; i < N_RECS; i++) {
+			dtuple_t*	tuple = make_tuple(
+				tuple_heap, b[i], key(i), int(i % N_DUPS),
+				2 + !!level);
+
+			if (level) {
+				mach_write_to_4(b[i] + 12, ulint(i));
+				dfield_t* f = dtuple_get_nth_field(tuple, 2);
+				dfield_set_data(f, b[i] + 12, 4);
+				dtype_set(dfield_get_type(f), DATA_SYS_CHILD,
+					  DATA_NOT_NULL, 4);
+				dtuple_set_info_bits(
+					tuple, i ? REC_STATUS_NODE_PTR
+					: REC_STATUS_NODE_PTR
+					| REC_INFO_MIN_REC_FLAG);
+				dtuple_set_n_fields_cmp(tuple, 2);
+			}
+
+			cur.rec = page_cur_tuple_insert(
+				&cur, tuple, index, &offsets, &heap, 0, NULL);
+			ut_a(cur.rec);
+		}
+
+		mem_heap_free(heap);
+		mem_heap_free(tuple_heap);
+		/* Keep page_cur_try_search_shortcut() out of the way. */
+		mach_write_to_2(page + PAGE_HEADER + PAGE_N_DIRECTION, 0);
+	}
+
+	/** Create a search tuple.
+	@param[in,out]	heap	memory heap
+	@param[out]	b	buffer for the fields
+	@param[in]	k	value of the first field
+	@param[in]	v	value of the second field, or -1 to
+	only compare the first field
+	@param[in]	n	number of fields
+	@return the search tuple */
+	dtuple_t* make_tuple(mem_heap_t* heap, byte* b, int k, int v,
+			     ulint n) const
+	{
+		dtuple_t*		tuple = dtuple_create(heap, n);
+		const dict_col_t*	col = dict_index_get_nth_col(index, 0);
+
+		mach_write_ulonglong(b, ulonglong(longlong(k)), col->len,
+				     false);
+		dfield_set_data(dtuple_get_nth_field(tuple, 0), b, col->len);
+		dict_col_copy_type(col, dfield_get_type(
+					   dtuple_get_nth_field(tuple, 0)));
+
+		if (n > 1) {
+			mach_write_to_4(b + 8, ulint(v < 0 ? 0 : v));
+			dfield_set_data(dtuple_get_nth_field(tuple, 1),
+					b + 8, 4);
+			dict_col_copy_type(dict_index_get_nth_col(index, 1),
+					   dfield_get_type(
+						   dtuple_get_nth_field(
+							   tuple, 1)));
+		}
+
+		if (v < 0) {
+			dtuple_set_n_fields_cmp(tuple, 1);
+		}
+
+		return(tuple);
+	}
+
+	/** @return the value of the first field of the i-th record */
+	static int key(ulint i)
+	{
+		return(KEY_MIN + int(i / N_DUPS) * KEY_STEP);
+	}
+};
+
+/** Find the record that a search should position the cursor on,
+by comparing the tuple with every record of the page.
+@param[in]	t	index and page
+@param[in]	tuple	search tuple
+@param[in]	mode	search mode
+@return ordinal number of the record: 0 for the page infimum,
+N_RECS + 1 for the page supremum */
+static ulint linear_search(const test_index_t& t, const dtuple_t* tuple,
+			   page_cur_mode_t mode)
+{
+	const page_t*	page = t.block->frame;
+	const bool	is_leaf = page_is_leaf(page);
+	mem_heap_t*	heap = NULL;
+	ulint		offsets_[REC_OFFS_NORMAL_SIZE];
+	ulint*		offsets = offsets_;
+	rec_offs_init(offsets_);
+	ulint		n = 0;
+
+	for (const rec_t* rec = page_rec_get_next_const(
+		     page_get_infimum_rec(page));
+	     !page_rec_is_supremum(rec);
+	     rec = page_rec_get_next_const(rec)) {
+		offsets = rec_get_offsets(rec, t.index, offsets, is_leaf,
+					  ULINT_UNDEFINED, &heap);
+		int	cmp = cmp_dtuple_rec(tuple, rec, offsets);
+
+		if (cmp > 0
+		    || (!cmp && (mode == PAGE_CUR_LE || mode == PAGE_CUR_G))) {
+			n++;
+		}
+	}
+
+	if (heap) {
+		mem_heap_free(heap);
+	}
+
+	return(mode == PAGE_CUR_G || mode == PAGE_CUR_GE ? n + 1 : n);
+}
+
+/** @return ordinal number of the record that a cursor is positioned on */
+static ulint cursor_pos(const page_cur_t& cur)
+{
+	ulint	n = 0;
+
+	for (const rec_t* rec = page_get_infimum_rec(page_align(cur.rec));
+	     rec != cur.rec; rec = page_rec_get_next_const(rec)) {
+		n++;
+	}
+
+	return(n);
+}
+
+/** Search for keys around and between all keys of the page, on the
+page of the NOT NULL column and on the page of the nullable column.
+@param[in]	type	type of the first field
+@param[in]	level	0 for leaf pages, 1 for node pointer pages */
+static void test_search(const key_type_t& type, ulint level)
+{
+	test_index_t	fast(type, true, true);
+	test_index_t	slow(type, false, true);
+	static const page_cur_mode_t modes[] = {
+		PAGE_CUR_L, PAGE_CUR_LE, PAGE_CUR_G, PAGE_CUR_GE
+	};
+	mem_heap_t*	heap = mem_heap_create(1024);
+	ulint		n_searches = 0;
+	ulint		n_fast = 0;
+	ulint		n_wrong = 0;
+
+	fast.create_page(level);
+	slow.create_page(level);
+
+	for (int k = KEY_MIN - KEY_STEP;
+	     k <= test_index_t::key(N_RECS - 1) + KEY_STEP; k++) {
+		for (int v = -1; v <= int(N_DUPS); v++) {
+			byte		b[2][16];
+			const dtuple_t*	ft = fast.make_tuple(
+				heap, b[0], k, v, v < 0 ? 1 : 2);
+			const dtuple_t*	st = slow.make_tuple(
+				heap, b[1], k, v, v < 0 ? 1 : 2);
+
+			/* Only the NOT NULL column may be compared
+			without rec_get_offsets(). */
+			n_fast += page_cur_key_prefix_len(fast.index, ft)
+				== type.len
+				&& !page_cur_key_prefix_len(slow.index, st);
+
+			for (ulint m = 0; m < array_elements(modes); m++) {
+				page_cur_t	fc, sc;
+				ulint		fup = 0, flow = 0;
+				ulint		sup = 0, slow_low = 0;
+
+				page_cur_search_with_match(
+					fast.block, fast.index, ft, modes[m],
+					&fup, &flow, &fc, NULL);
+				page_cur_search_with_match(
+					slow.block, slow.index, st, modes[m],
+					&sup, &slow_low, &sc, NULL);
+
+				const ulint	pos = cursor_pos(fc);
+
+				if (pos != cursor_pos(sc)
+				    || pos != linear_search(fast, ft, modes[m])
+				    || fup != sup || flow != slow_low) {
+					if (!n_wrong++) {
+						diag("%s %s k=%d v=%d mode=%d:"
+						     " record %lu, %lu,"
+						     " expected %lu",
+						     type.name,
+						     level ? "node pointer"
+						     : "leaf",
+						     k, v, int(modes[m]),
+						     ulong(pos),
+						     ulong(cursor_pos(sc)),
+						     ulong(linear_search(
+							fast, ft,
+							modes[m])));
+					}
+				}
+
+				n_searches++;
+			}
+
+			mem_heap_empty(heap);
+		}
+	}
+
+	mem_heap_free(heap);
+
+	ok(n_fast * array_elements(modes) == n_searches && !n_wrong,
+	   "%s %s page: %lu searches", type.name,
+	   level ? "node pointer" : "leaf", ulong(n_searches));
+}
+
+/** Check when page_cur_key_prefix_len() rejects the fast comparison.
+@param[in]	type	type of the first field */
+static void test_prefix_len(const key_type_t& type)
+{
+	test_index_t	not_null(type, true, true);
+	test_index_t	nullable(type, false, true);
+	test_index_t	redundant(type, true, false);
+	mem_heap_t*	heap = mem_heap_create(256);
+	byte		b[16];
+	dtuple_t*	tuple = not_null.make_tuple(heap, b, 1, -1, 1);
+
+	ok(page_cur_key_prefix_len(not_null.index, tuple) == type.len,
+	   "%s NOT NULL", type.name);
+
+	dtuple_set_info_bits(tuple, REC_INFO_MIN_REC_FLAG);
+	ok(!page_cur_key_prefix_len(not_null.index, tuple),
+	   "%s: not for the minimum record", type.name);
+
+	ok(!page_cur_key_prefix_len(nullable.index,
+				    nullable.make_tuple(heap, b, 1, -1, 1)),
+	   "%s NULL: not used", type.name);
+	ok(!page_cur_key_prefix_len(redundant.index,
+				    redundant.make_tuple(heap, b, 1, -1, 1)),
+	   "%s ROW_FORMAT=REDUNDANT: not used", type.name);
+
+	mem_heap_free(heap);
+}
+
+/** Check that other fixed-length column types are not compared
+as integers. */
+static void test_prefix_len_other()
+{
+	static const key_type_t	others[] = {
+		/* Collated strings do not compare like integers. */
+		{ "CHAR(4)", DATA_MYSQL, 8 << 16, 4 },
+		{ "BINARY(4) latin1", DATA_FIXBINARY, 8 << 16, 4 },
+		/* Longer keys do not fit in 64 bits. */
+		{ "BINARY(9)", DATA_FIXBINARY,
+		  DATA_MYSQL_BINARY_CHARSET_COLL << 16, 9 },
+		/* Floating-point numbers are not stored in
+		memcmp() order. */
+		{ "DOUBLE", DATA_DOUBLE, 0, 8 }
+	};
+
+	for (ulint i = 0; i < array_elements(others); i++) {
+		test_index_t	t(others[i], true, true);
+		dtuple_t*	tuple = dtuple_create(t.index->heap, 1);
+		byte		b[16];
+
+		memset(b, 0, sizeof b);
+		dfield_set_data(dtuple_get_nth_field(tuple, 0), b,
+				others[i].len);
+		dict_col_copy_type(dict_index_get_nth_col(t.index, 0),
+				   dfield_get_type(
+					   dtuple_get_nth_field(tuple, 0)));
+		ok(!page_cur_key_prefix_len(t.index, tuple),
+		   "%s: not used", others[i].name);
+	}
+}
+
+int main(int, char** argv)
+{
+	MY_INIT(argv[0]);
+	plan(int(array_elements(key_types)) * (2 + 4) + 4);
+
+	/* Load all_charsets[] for dtype_get_mblen() */
+	get_charset(DATA_MYSQL_BINARY_CHARSET_COLL, MYF(0));
+
+	srv_page_size_shift = UNIV_PAGE_SIZE_SHIFT_DEF;
+	srv_page_size = UNIV_PAGE_SIZE_DEF;
+	srv_max_n_threads = 1;
+	sync_check_init();
+
+	for (ulint i = 0; i < array_elements(key_types); i++) {
+		test_prefix_len(key_types[i]);
+		test_search(key_types[i], 0);
+		test_search(key_types[i], 1);
+	}
+
+	test_prefix_len_other();
+
+	sync_check_close();
+	my_end(0);
+
+	return exit_status();
+}